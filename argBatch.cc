@@ -0,0 +1,205 @@
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "argBatch.hh"
+#include "environment.hh"
+#include "pipeline.hh"
+#include "spawn.hh"
+
+// Room left in ARG_MAX for the kernel and the program, as xargs does.
+#define ARG_HEADROOM 2048
+
+// Number of batches to run at the same time, or 0 if batching is off.
+int ArgBatch::jobs() {
+  std::string batch_env;
+  if (!Environment::get("ARG_BATCH", batch_env)) return 0;
+  int jobs = atoi(batch_env.c_str());
+  if (jobs <= 0) jobs = sysconf(_SC_NPROCESSORS_ONLN);
+  return jobs > 0 ? jobs : 1;
+}
+
+// Bytes an argument or environment string takes in the new program.
+static size_t space(const char * string) {
+  return strlen(string) + 1 + sizeof(char *);
+}
+
+// Copy the contents of a finished batch's output file to fd.
+static void copyOutput(int from, int to) {
+  char buffer[65536];
+  lseek(from, 0, SEEK_SET);
+  ssize_t count;
+  while ((count = read(from, buffer, sizeof(buffer))) > 0 || (count == -1 && errno == EINTR)) {
+    for (ssize_t written = 0; count > 0 && written < count; ) {
+      ssize_t w = write(to, buffer + written, count - written);
+      if (w == -1 && errno == EINTR) continue;
+      if (w == -1) return;
+      written += w;
+    }
+  }
+}
+
+// Position of each argument of argv among the expanded ones, or -1 for
+// the arguments every batch gets.
+static std::vector<long> positions(const std::vector<char *> & argv,
+                                   const ArgBatch::Ranges & expanded) {
+  std::vector<long> position(argv.size(), -1);
+  long next = 0;
+  for (auto & range : expanded) {
+    for (size_t i = range.first; i <= range.second; i++) position[i] = next++;
+  }
+  return position;
+}
+
+// Split the expanded arguments of argv into batches that each fit in
+// ARG_MAX together with the other arguments and the environment. Returns
+// false if a single argument is too large to fit on its own.
+static bool split(const std::vector<char *> & argv, const std::vector<long> & position,
+                  std::vector<ArgBatch::Batch> & batches) {
+  long arg_max = sysconf(_SC_ARG_MAX);
+  size_t fixed = ARG_HEADROOM + sizeof(char *);
+  for (char ** env = Environment::environ(); *env; env++) fixed += space(*env);
+  std::vector<size_t> expanded;
+  for (size_t i = 0; argv[i]; i++) {
+    if (position[i] < 0) fixed += space(argv[i]);
+    else expanded.push_back(i);
+  }
+  if (arg_max <= 0 || fixed >= (size_t)arg_max) return false;
+  size_t room = arg_max - fixed;
+
+  size_t used = 0;
+  for (size_t i = 0; i < expanded.size(); i++) {
+    size_t size = space(argv[expanded[i]]);
+    if (size > room) return false;
+    if (batches.empty() || used + size > room) {
+      batches.push_back({i, i, -1, -1, -1});
+      used = 0;
+    }
+    batches.back()._last = i;
+    used += size;
+  }
+  return true;
+}
+
+// Run one batch: the arguments of argv that were not expanded, in their
+// places among the batch's share of the expanded ones.
+static pid_t start(const char * path, const std::vector<char *> & argv,
+                   const std::vector<long> & position, ArgBatch::Batch & batch, int fdout) {
+  std::vector<char *> batch_argv;
+  for (size_t i = 0; argv[i]; i++) {
+    if (position[i] < 0 ||
+        ((size_t)position[i] >= batch._first && (size_t)position[i] <= batch._last)) {
+      batch_argv.push_back(argv[i]);
+    }
+  }
+  batch_argv.push_back(NULL);
+  return Spawn::launch(path, batch_argv.data(), 0, fdout, 2);
+}
+
+// Body of the helper process: run every batch, at most jobs at a time.
+// With more than one job each batch writes into its own temporary file,
+// and the files are copied to stdout in batch order as soon as all the
+// batches before them are done, so the output reads as one command's.
+// Exits with the status of the first batch that failed (or 0).
+static int runBatches(const char * path, const std::vector<char *> & argv,
+                      const ArgBatch::Ranges & expanded, int jobs) {
+  std::vector<long> position = positions(argv, expanded);
+  std::vector<ArgBatch::Batch> batches;
+  if (!split(argv, position, batches)) {
+    errno = E2BIG;
+    perror(argv[0]);
+    return 126;
+  }
+
+  size_t started = 0, finished = 0, printed = 0;
+  int running = 0;
+  while (printed < batches.size()) {
+    // Start batches until the job limit is reached.
+    while (started < batches.size() && running < jobs) {
+      ArgBatch::Batch & batch = batches[started++];
+      int fdout = 1;
+      if (jobs > 1) {
+        FILE * output = tmpfile();
+        if (output != NULL) {
+          batch._output = fcntl(fileno(output), F_DUPFD_CLOEXEC, 0);
+          fclose(output);
+          fdout = batch._output;
+        }
+      }
+      batch._pid = start(path, argv, position, batch, fdout);
+      if (batch._pid < 0) {
+        perror("execvp");
+        batch._status = 1;
+        finished++;
+      } else {
+        running++;
+      }
+    }
+
+    // Copy out the output of every finished batch whose predecessors
+    // have all been copied.
+    while (printed < started && (batches[printed]._pid < 0 || batches[printed]._status != -1)) {
+      if (batches[printed]._output != -1) {
+        copyOutput(batches[printed]._output, 1);
+        close(batches[printed]._output);
+      }
+      printed++;
+    }
+    if (printed == batches.size() || finished == started) continue;
+
+    // Wait for the next batch to exit.
+    int status;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid == -1) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    for (size_t i = 0; i < started; i++) {
+      if (batches[i]._pid == pid) {
+        batches[i]._status = Pipeline::exitStatus(status);
+        finished++;
+        running--;
+      }
+    }
+  }
+
+  for (auto & batch : batches) {
+    if (batch._status > 0) return batch._status;
+  }
+  return 0;
+}
+
+// Launch a command whose expanded arguments (the ranges produced by
+// expanding wildcards or braces) are too large for a single exec. A helper
+// process with fdin[stage]/fdout[stage]/fderr as its stdin/stdout/stderr
+// runs the batches and exits with their combined status, so the pipeline
+// sees a single stage. The helper does not exec, so it closes the
+// descriptors of the stages not launched yet (0 to stage), or the pipes
+// around it would never see EOF. Returns the helper's PID, or -1 if it
+// could not be forked.
+pid_t ArgBatch::launch(const char * path, const std::vector<char *> & argv,
+                       const Ranges & expanded, const std::vector<int> & fdin,
+                       const std::vector<int> & fdout, size_t stage, int fderr) {
+  int jobs = ArgBatch::jobs();
+  pid_t pid = fork();
+  if (pid == 0) {
+    signal(SIGINT, SIG_DFL);
+    signal(SIGCHLD, SIG_DFL);
+    dup2(fdin[stage], 0);
+    dup2(fdout[stage], 1);
+    dup2(fderr, 2);
+    for (size_t j = 0; j <= stage; j++) {
+      close(fdin[j]);
+      close(fdout[j]);
+    }
+    close(fderr);
+    _exit(runBatches(path, argv, expanded, jobs));
+  }
+  return pid;
+}
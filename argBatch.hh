@@ -0,0 +1,38 @@
+#ifndef argBatch_hh
+#define argBatch_hh
+
+#include <sys/types.h>
+#include <utility>
+#include <vector>
+
+// Argument Batch Data Structure: runs a command whose expanded arguments
+// do not fit in one exec (E2BIG) as several execs, like xargs. Enabled by
+// setting ARG_BATCH to the number of batches to run at once (0 for one
+// per core).
+
+struct ArgBatch {
+
+  // Ranges (first and last index in argv) of the arguments that may be
+  // split across execs; every other argument is passed to each exec.
+  typedef std::vector<std::pair<size_t, size_t>> Ranges;
+
+  // One exec of the command: its share of the expanded arguments (first
+  // and last position among all of them, in order), its process, the
+  // temporary file holding its output when batches run in parallel, and
+  // its exit status.
+  struct Batch {
+    size_t _first;
+    size_t _last;
+    pid_t _pid;
+    int _output;
+    int _status;
+  };
+
+  static int jobs();
+  static pid_t launch(const char * path, const std::vector<char *> & argv,
+                      const Ranges & expanded, const std::vector<int> & fdin,
+                      const std::vector<int> & fdout, size_t stage, int fderr);
+
+};
+
+#endif
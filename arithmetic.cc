@@ -0,0 +1,331 @@
+#include <cctype>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "arithmetic.hh"
+#include "environment.hh"
+#include "wordExpansion.hh"
+
+// Most expressions the cache keeps; it is emptied when it fills up.
+#define ARITHMETIC_CACHE_SIZE 4096
+
+std::unordered_map<std::string, std::shared_ptr<const Arithmetic::Expression>> Arithmetic::_cache;
+
+// Binary operators by their text (longest first), with their precedence:
+// a higher one binds tighter.
+static const struct { const char * _text; Arithmetic::Op _op; int _precedence; } binary_ops[] = {
+  { "<<", Arithmetic::SHIFT_LEFT, 8 }, { ">>", Arithmetic::SHIFT_RIGHT, 8 },
+  { "<=", Arithmetic::LESS_EQUAL, 7 }, { ">=", Arithmetic::GREATER_EQUAL, 7 },
+  { "==", Arithmetic::EQUAL, 6 }, { "!=", Arithmetic::NOT_EQUAL, 6 },
+  { "&&", Arithmetic::AND, 2 }, { "||", Arithmetic::OR, 1 },
+  { "*", Arithmetic::MULTIPLY, 10 }, { "/", Arithmetic::DIVIDE, 10 }, { "%", Arithmetic::MODULO, 10 },
+  { "+", Arithmetic::ADD, 9 }, { "-", Arithmetic::SUBTRACT, 9 },
+  { "<", Arithmetic::LESS_THAN, 7 }, { ">", Arithmetic::GREATER_THAN, 7 },
+  { "&", Arithmetic::BIT_AND, 5 }, { "^", Arithmetic::BIT_XOR, 4 }, { "|", Arithmetic::BIT_OR, 3 },
+};
+
+// Assignment operators by their text.
+static const struct { const char * _text; Arithmetic::Op _compound; } assign_ops[] = {
+  { "*=", Arithmetic::MULTIPLY }, { "/=", Arithmetic::DIVIDE }, { "%=", Arithmetic::MODULO },
+  { "+=", Arithmetic::ADD }, { "-=", Arithmetic::SUBTRACT }, { "=", Arithmetic::ASSIGN },
+};
+
+// Recursive descent parser of an expression text into the nodes of an
+// expression. Every parse function returns the index of the node it
+// added, or -1 on a syntax error.
+struct ArithmeticParser {
+  const std::string & _text;
+  size_t _position;
+  Arithmetic::Expression & _expression;
+
+  void skipSpaces() {
+    while (_position < _text.size() && isspace((unsigned char) _text[_position])) _position++;
+  }
+
+  bool match( const char * token ) {
+    skipSpaces();
+    size_t length = strlen(token);
+    if (_text.compare(_position, length, token) != 0) return false;
+    _position += length;
+    return true;
+  }
+
+  int add( Arithmetic::Op op, int left = -1, int right = -1, int third = -1 ) {
+    _expression._nodes.push_back({op, 0, "", left, right, third, Arithmetic::ASSIGN});
+    return _expression._nodes.size() - 1;
+  }
+
+  // Read a variable name (bare, $name or ${name}) into name.
+  bool name( std::string & name ) {
+    skipSpaces();
+    size_t start = _position;
+    bool braces = false;
+    if (_position < _text.size() && _text[_position] == '$') {
+      _position++;
+      braces = _position < _text.size() && _text[_position] == '{';
+      if (braces) _position++;
+    }
+    size_t begin = _position;
+    if (braces) {
+      while (_position < _text.size() && _text[_position] != '}') _position++;
+    } else if (_position < _text.size() &&
+               (isalpha((unsigned char) _text[_position]) || _text[_position] == '_')) {
+      while (_position < _text.size() &&
+             (isalnum((unsigned char) _text[_position]) || _text[_position] == '_')) {
+        _position++;
+      }
+    } else if (start != begin) {
+      while (_position < _text.size() && isdigit((unsigned char) _text[_position])) _position++;
+    }
+    if (_position == begin || (braces && _position == _text.size())) {
+      _position = start;
+      return false;
+    }
+    name = _text.substr(begin, _position - begin);
+    if (braces) _position++;
+    return true;
+  }
+
+  // A number, a variable, a parenthesized expression, or a unary operator
+  // applied to one of them.
+  int primary() {
+    skipSpaces();
+    if (_position >= _text.size()) return -1;
+    char c = _text[_position];
+    if (c == '(') {
+      _position++;
+      int node = assignment();
+      if (node < 0 || !match(")")) return -1;
+      return node;
+    }
+    static const struct { char _text; Arithmetic::Op _op; } unary_ops[] = {
+      { '-', Arithmetic::NEGATE }, { '+', Arithmetic::PLUS },
+      { '!', Arithmetic::NOT }, { '~', Arithmetic::COMPLEMENT },
+    };
+    for (auto & unary : unary_ops) {
+      if (c == unary._text) {
+        _position++;
+        int operand = primary();
+        if (operand < 0) return -1;
+        return add(unary._op, operand);
+      }
+    }
+    if (isdigit((unsigned char) c)) {
+      char * end;
+      long value = strtol(_text.c_str() + _position, &end, 0);
+      if (isalnum((unsigned char) *end) || *end == '_') return -1;
+      _position = end - _text.c_str();
+      int node = add(Arithmetic::NUMBER);
+      _expression._nodes[node]._value = value;
+      return node;
+    }
+    std::string variable;
+    if (!name(variable)) return -1;
+    int node = add(Arithmetic::VARIABLE);
+    _expression._nodes[node]._name = variable;
+    return node;
+  }
+
+  // Binary operators binding at least as tight as precedence, left to
+  // right.
+  int binary( int precedence ) {
+    int left = primary();
+    while (left >= 0) {
+      skipSpaces();
+      const Arithmetic::Op * op = NULL;
+      int found = 0;
+      size_t length = 0;
+      for (auto & binary : binary_ops) {
+        length = strlen(binary._text);
+        if (_text.compare(_position, length, binary._text) == 0) {
+          op = &binary._op;
+          found = binary._precedence;
+          break;
+        }
+      }
+      if (!op || found < precedence) break;
+      _position += length;
+      int right = binary(found + 1);
+      if (right < 0) return -1;
+      left = add(*op, left, right);
+    }
+    return left;
+  }
+
+  // condition ? value : value
+  int conditional() {
+    int condition = binary(1);
+    if (condition < 0 || !match("?")) return condition;
+    int yes = assignment();
+    if (yes < 0 || !match(":")) return -1;
+    int no = conditional();
+    if (no < 0) return -1;
+    return add(Arithmetic::CONDITIONAL, condition, yes, no);
+  }
+
+  // name = value, name += value, ... (right to left), or a conditional.
+  int assignment() {
+    size_t start = _position;
+    std::string variable;
+    if (name(variable)) {
+      skipSpaces();
+      for (auto & assign : assign_ops) {
+        size_t length = strlen(assign._text);
+        if (_text.compare(_position, length, assign._text) == 0 &&
+            _text.compare(_position, 2, "==") != 0) {
+          _position += length;
+          int value = assignment();
+          if (value < 0) return -1;
+          int node = add(Arithmetic::ASSIGN, -1, value);
+          _expression._nodes[node]._name = variable;
+          _expression._nodes[node]._compound = assign._compound;
+          return node;
+        }
+      }
+    }
+    _position = start;
+    return conditional();
+  }
+};
+
+// Parse text into an expression tree, reusing the cached tree of the same
+// text. Returns NULL on a syntax error.
+std::shared_ptr<const Arithmetic::Expression> Arithmetic::compile( const std::string & text ) {
+  auto entry = _cache.find(text);
+  if (entry != _cache.end()) return entry->second;
+
+  std::shared_ptr<Expression> expression = std::make_shared<Expression>();
+  ArithmeticParser parser{text, 0, *expression};
+  expression->_root = parser.assignment();
+  parser.skipSpaces();
+  if (expression->_root < 0 || parser._position != text.size()) return NULL;
+
+  if (_cache.size() >= ARITHMETIC_CACHE_SIZE) _cache.clear();
+  _cache[text] = expression;
+  return expression;
+}
+
+// Apply the binary operator op. +, - and * wrap around on overflow, as
+// they are computed in unsigned arithmetic. Returns false on division by
+// zero, on the one division that overflows (LONG_MIN / -1, which traps),
+// and on a shift by a negative count or by the width of a long or more.
+static bool apply( Arithmetic::Op op, long left, long right, long & value ) {
+  switch (op) {
+  case Arithmetic::MULTIPLY: value = (long)((unsigned long)left * (unsigned long)right); break;
+  case Arithmetic::DIVIDE:
+  case Arithmetic::MODULO:
+    if (right == 0) {
+      fprintf(stderr, "arithmetic: division by zero\n");
+      return false;
+    }
+    if (left == LONG_MIN && right == -1) {
+      fprintf(stderr, "arithmetic: division overflow\n");
+      return false;
+    }
+    value = op == Arithmetic::DIVIDE ? left / right : left % right;
+    break;
+  case Arithmetic::ADD: value = (long)((unsigned long)left + (unsigned long)right); break;
+  case Arithmetic::SUBTRACT: value = (long)((unsigned long)left - (unsigned long)right); break;
+  case Arithmetic::SHIFT_LEFT:
+  case Arithmetic::SHIFT_RIGHT:
+    if (right < 0 || right >= (long)(sizeof(long) * CHAR_BIT)) {
+      fprintf(stderr, "arithmetic: shift count out of range\n");
+      return false;
+    }
+    value = op == Arithmetic::SHIFT_LEFT ? (long)((unsigned long)left << right) : left >> right;
+    break;
+  case Arithmetic::LESS_THAN: value = left < right; break;
+  case Arithmetic::LESS_EQUAL: value = left <= right; break;
+  case Arithmetic::GREATER_THAN: value = left > right; break;
+  case Arithmetic::GREATER_EQUAL: value = left >= right; break;
+  case Arithmetic::EQUAL: value = left == right; break;
+  case Arithmetic::NOT_EQUAL: value = left != right; break;
+  case Arithmetic::BIT_AND: value = left & right; break;
+  case Arithmetic::BIT_XOR: value = left ^ right; break;
+  case Arithmetic::BIT_OR: value = left | right; break;
+  default: value = right; break;
+  }
+  return true;
+}
+
+// Read the variable name as a number: unset or empty is 0. Returns false
+// if its value is not a number.
+static bool variable( const std::string & name, long & value ) {
+  std::string text;
+  if (!WordExpansion::variable(name, text) || text.empty()) {
+    value = 0;
+    return true;
+  }
+  char * end;
+  value = strtol(text.c_str(), &end, 0);
+  if (*end != '\0') {
+    fprintf(stderr, "arithmetic: %s: not a number\n", name.c_str());
+    return false;
+  }
+  return true;
+}
+
+// Evaluate node of expression into value. && and || only evaluate their
+// right side, and ?: only the chosen side, when needed. Returns false on
+// an error.
+bool Arithmetic::evaluate( const Expression & expression, int node, long & value ) {
+  const Node & n = expression._nodes[node];
+  long left, right;
+  switch (n._op) {
+  case NUMBER:
+    value = n._value;
+    return true;
+  case VARIABLE:
+    return variable(n._name, value);
+  case NEGATE:
+  case PLUS:
+  case NOT:
+  case COMPLEMENT:
+    if (!evaluate(expression, n._left, left)) return false;
+    value = n._op == NEGATE ? (long)(0UL - (unsigned long)left) :
+            n._op == PLUS ? left : n._op == NOT ? !left : ~left;
+    return true;
+  case AND:
+  case OR:
+    if (!evaluate(expression, n._left, left)) return false;
+    if ((n._op == AND) == (left == 0)) {
+      value = n._op == OR;
+      return true;
+    }
+    if (!evaluate(expression, n._right, right)) return false;
+    value = right != 0;
+    return true;
+  case CONDITIONAL:
+    if (!evaluate(expression, n._left, left)) return false;
+    return evaluate(expression, left ? n._right : n._third, value);
+  case ASSIGN:
+    if (!evaluate(expression, n._right, right)) return false;
+    if (n._compound != ASSIGN) {
+      if (!variable(n._name, left) || !apply(n._compound, left, right, right)) return false;
+    }
+    value = right;
+    Environment::set(n._name, std::to_string(value));
+    return true;
+  default:
+    if (!evaluate(expression, n._left, left) || !evaluate(expression, n._right, right)) {
+      return false;
+    }
+    return apply(n._op, left, right, value);
+  }
+}
+
+// Evaluate the expression text and append its value to result. Returns
+// false on a syntax error or an error while evaluating.
+bool Arithmetic::evaluate( const std::string & text, std::string & result ) {
+  std::shared_ptr<const Expression> expression = compile(text);
+  if (!expression) {
+    fprintf(stderr, "arithmetic: syntax error in \"%s\"\n", text.c_str());
+    return false;
+  }
+  long value;
+  if (!evaluate(*expression, expression->_root, value)) return false;
+  result += std::to_string(value);
+  return true;
+}
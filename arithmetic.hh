@@ -0,0 +1,52 @@
+#ifndef arithmetic_hh
+#define arithmetic_hh
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Arithmetic Data Structure: evaluates the integer expressions of $(( ))
+// inside the shell. Each expression text is parsed once into a tree,
+// kept in a cache keyed on the text, so an expression run again (in a
+// loop, say) is only evaluated. Variables are read when it is evaluated,
+// which keeps the text, and so the cache entry, the same.
+
+struct Arithmetic {
+
+  enum Op {
+    NUMBER, VARIABLE,
+    NEGATE, PLUS, NOT, COMPLEMENT,
+    MULTIPLY, DIVIDE, MODULO, ADD, SUBTRACT, SHIFT_LEFT, SHIFT_RIGHT,
+    LESS_THAN, LESS_EQUAL, GREATER_THAN, GREATER_EQUAL, EQUAL, NOT_EQUAL,
+    BIT_AND, BIT_XOR, BIT_OR, AND, OR,
+    CONDITIONAL, ASSIGN,
+  };
+
+  // A node of an expression tree. Operands are indices into the nodes of
+  // the expression. An ASSIGN sets the variable _name to its right
+  // operand, first combined with the variable by _compound unless that is
+  // ASSIGN itself (for +=, -= and so on).
+  struct Node {
+    Op _op;
+    long _value;
+    std::string _name;
+    int _left;
+    int _right;
+    int _third;
+    Op _compound;
+  };
+
+  struct Expression {
+    std::vector<Node> _nodes;
+    int _root;
+  };
+
+  static bool evaluate( const std::string & text, std::string & result );
+  static std::shared_ptr<const Expression> compile( const std::string & text );
+  static bool evaluate( const Expression & expression, int node, long & value );
+
+  static std::unordered_map<std::string, std::shared_ptr<const Expression>> _cache;
+};
+
+#endif
@@ -0,0 +1,14 @@
+#include "ast.hh"
+
+Node::Node( Type type ) {
+  _type = type;
+  _background = false;
+}
+
+Node::~Node() {
+  // Delete every child node along with this one.
+  for (auto & child : _children) {
+    delete child;
+  }
+  _children.clear();
+}
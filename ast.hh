@@ -0,0 +1,64 @@
+#ifndef ast_hh
+#define ast_hh
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Abstract Syntax Tree: what the parser produces for each command line.
+// Nothing in it is expanded yet; the executor expands the words every time
+// a node runs.
+
+// A word as it was written. Unquoted and quoted words go through variable,
+// tilde and quote expansion; a command substitution holds the command
+// whose output replaces it.
+struct Word {
+  enum Kind { UNQUOTED, QUOTED, SUBSTITUTION };
+
+  Kind _kind;
+  std::string _text;
+};
+
+// A redirection of the pipeline's stdin, stdout and/or stderr to a file.
+struct Redirect {
+  enum Type { IN, OUT, APPEND, OUT_ERR, APPEND_ERR, ERR };
+
+  Type _type;
+  Word _target;
+};
+
+// A command name followed by its arguments.
+struct SimpleCommandNode {
+  std::vector<Word> _words;
+};
+
+struct Node {
+  enum Type { LIST, PIPELINE, IF, WHILE, FOR, FUNCTION };
+
+  Type _type;
+
+  // LIST: commands run one after the other.
+  std::vector<Node *> _children;
+
+  // PIPELINE: simple commands connected by pipes, the redirections of the
+  // whole pipeline and whether it runs in the background.
+  std::vector<SimpleCommandNode> _commands;
+  std::vector<Redirect> _redirects;
+  bool _background;
+
+  // IF: _children holds a condition and its body for the if and each
+  // elif, then the else body if there is one.
+  // WHILE: _children holds the condition and the body.
+  // FOR: the body in _children runs with variable _name set to each
+  // expanded word of _words in turn.
+  // FUNCTION: defines the function _name with _body, which is shared with
+  // the function table so it outlives the command line.
+  std::string _name;
+  std::vector<Word> _words;
+  std::shared_ptr<const Node> _body;
+
+  Node( Type type );
+  ~Node();
+};
+
+#endif
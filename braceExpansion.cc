@@ -0,0 +1,271 @@
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "braceExpansion.hh"
+#include "environment.hh"
+
+// Largest number of words a single brace expansion may generate, unless
+// overridden with the BRACE_MAX environment variable (0 means no limit).
+#define DEFAULT_BRACE_MAX (1 << 20)
+
+// Multiply two word counts, saturating instead of overflowing.
+static size_t multiply(size_t a, size_t b) {
+  if (a != 0 && b > SIZE_MAX / a) return SIZE_MAX;
+  return a * b;
+}
+
+// Parse an integer endpoint or step of a range. Returns false if text is
+// not entirely an optionally signed decimal number.
+static bool parseNumber(const std::string & text, long & value) {
+  if (text.empty()) return false;
+  size_t i = (text[0] == '-' || text[0] == '+') ? 1 : 0;
+  if (i == text.size()) return false;
+  for (size_t j = i; j < text.size(); j++) {
+    if (text[j] < '0' || text[j] > '9') return false;
+  }
+  value = strtol(text.c_str(), NULL, 10);
+  return true;
+}
+
+// Endpoints written with a leading zero (01, -007) pad every generated
+// number to the width of the longest endpoint.
+static bool zeroPadded(const std::string & text) {
+  size_t i = (text[0] == '-' || text[0] == '+') ? 1 : 0;
+  return text.size() > i + 1 && text[i] == '0';
+}
+
+// Parse the text between the braces of a range: x..y or x..y..step with
+// integer or single letter endpoints. Returns false if it is not a range
+// or any of it is literal.
+static bool parseRange(const std::string & text, const std::string & literal,
+                       BraceExpansion::Item & item) {
+  if (literal.find('1') != std::string::npos) return false;
+  size_t dots = text.find("..");
+  if (dots == std::string::npos) return false;
+  std::string first = text.substr(0, dots);
+  std::string last = text.substr(dots + 2);
+  std::string step = "1";
+  size_t more = last.find("..");
+  if (more != std::string::npos) {
+    step = last.substr(more + 2);
+    last = last.substr(0, more);
+  }
+
+  long begin, end, increment;
+  if (!parseNumber(step, increment)) return false;
+  item._letters = false;
+  item._width = 0;
+  if (parseNumber(first, begin) && parseNumber(last, end)) {
+    if (zeroPadded(first) || zeroPadded(last)) {
+      item._width = first.size() > last.size() ? first.size() : last.size();
+    }
+  } else if (first.size() == 1 && last.size() == 1 && isalpha(first[0]) && isalpha(last[0])) {
+    begin = first[0];
+    end = last[0];
+    item._letters = true;
+  } else {
+    return false;
+  }
+
+  // The sign of the step is ignored: ranges always run from the first
+  // endpoint towards the last one.
+  if (increment == 0 || increment == LONG_MIN) increment = 1;
+  if (increment < 0) increment = -increment;
+  // Count in unsigned arithmetic: the distance between the endpoints of
+  // {-9223372036854775808..9223372036854775807} does not fit in a long,
+  // and the count of a step of 1 over it does not fit in a size_t either
+  // (it saturates, so it fails any BRACE_MAX limit).
+  unsigned long distance = begin <= end ? (unsigned long)end - (unsigned long)begin :
+                                          (unsigned long)begin - (unsigned long)end;
+  unsigned long steps = distance / (unsigned long)increment;
+  item._type = BraceExpansion::RANGE;
+  item._first = begin;
+  item._step = begin <= end ? increment : -increment;
+  item._count = steps >= SIZE_MAX ? SIZE_MAX : steps + 1;
+  return true;
+}
+
+// Parse text into a sequence of plain text, lists and ranges. A brace only
+// starts a list if it has a matching closing brace and a comma outside any
+// nested braces, and only starts a range if its contents form one; every
+// other brace is kept as text, and so are literal braces and commas (see
+// BraceExpansion). Returns true if any braces were expanded.
+static bool parseSequence(const std::string & text, const std::string & literal,
+                          BraceExpansion::Sequence & sequence) {
+  bool braces = false;
+  std::string plain;
+
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] != '{' || literal[i] == '1') {
+      plain += text[i];
+      continue;
+    }
+
+    // Find the matching brace and the commas at the top level inside it.
+    std::vector<size_t> commas;
+    size_t close = std::string::npos;
+    int depth = 1;
+    for (size_t j = i + 1; j < text.size(); j++) {
+      if (literal[j] == '1') continue;
+      if (text[j] == '{') depth++;
+      else if (text[j] == '}' && --depth == 0) {close = j; break;}
+      else if (text[j] == ',' && depth == 1) commas.push_back(j);
+    }
+
+    BraceExpansion::Item item;
+    if (close == std::string::npos) {
+      plain += text[i];
+      continue;
+    } else if (!commas.empty()) {
+      item._type = BraceExpansion::LIST;
+      commas.push_back(close);
+      size_t start = i + 1;
+      for (size_t comma : commas) {
+        item._alternatives.emplace_back();
+        parseSequence(text.substr(start, comma - start), literal.substr(start, comma - start),
+                      item._alternatives.back());
+        start = comma + 1;
+      }
+    } else if (!parseRange(text.substr(i + 1, close - i - 1),
+                           literal.substr(i + 1, close - i - 1), item)) {
+      plain += text[i];
+      continue;
+    }
+
+    if (!plain.empty()) {
+      BraceExpansion::Item literal;
+      literal._type = BraceExpansion::TEXT;
+      literal._text.swap(plain);
+      sequence._items.push_back(std::move(literal));
+    }
+    sequence._items.push_back(std::move(item));
+    braces = true;
+    i = close;
+  }
+
+  if (!plain.empty()) {
+    BraceExpansion::Item literal;
+    literal._type = BraceExpansion::TEXT;
+    literal._text.swap(plain);
+    sequence._items.push_back(std::move(literal));
+  }
+  return braces;
+}
+
+// Number of words a sequence expands to.
+static size_t countSequence(const BraceExpansion::Sequence & sequence) {
+  size_t total = 1;
+  for (auto & item : sequence._items) {
+    if (item._type == BraceExpansion::RANGE) {
+      total = multiply(total, item._count);
+    } else if (item._type == BraceExpansion::LIST) {
+      size_t alternatives = 0;
+      for (auto & alternative : item._alternatives) {
+        size_t n = countSequence(alternative);
+        alternatives = (n > SIZE_MAX - alternatives) ? SIZE_MAX : alternatives + n;
+      }
+      total = multiply(total, alternatives);
+    }
+  }
+  return total;
+}
+
+BraceExpansion::Cursor::Cursor( const Sequence * sequence ) {
+  _sequence = sequence;
+  _indexes = std::vector<size_t>(sequence->_items.size(), 0);
+  _children.resize(sequence->_items.size());
+  for (size_t i = 0; i < _indexes.size(); i++) reset(i);
+}
+
+// Move an item back to its first value.
+void BraceExpansion::Cursor::reset( size_t item ) {
+  _indexes[item] = 0;
+  const Item & current = _sequence->_items[item];
+  if (current._type == LIST) {
+    _children[item].reset(new Cursor(&current._alternatives[0]));
+  }
+}
+
+// Step to the next word like an odometer: the last item changes fastest,
+// and an item that runs out of values starts over while the one before it
+// advances. Returns false once every combination has been generated.
+bool BraceExpansion::Cursor::advance() {
+  for (size_t i = _indexes.size(); i-- > 0; ) {
+    const Item & current = _sequence->_items[i];
+    if (current._type == RANGE && _indexes[i] + 1 < current._count) {
+      _indexes[i]++;
+      return true;
+    }
+    if (current._type == LIST) {
+      if (_children[i]->advance()) return true;
+      if (_indexes[i] + 1 < current._alternatives.size()) {
+        _indexes[i]++;
+        _children[i].reset(new Cursor(&current._alternatives[_indexes[i]]));
+        return true;
+      }
+    }
+    reset(i);
+  }
+  return false;
+}
+
+// Append the word at the current position.
+void BraceExpansion::Cursor::append( std::string & word ) const {
+  for (size_t i = 0; i < _indexes.size(); i++) {
+    const Item & current = _sequence->_items[i];
+    if (current._type == TEXT) {
+      word += current._text;
+    } else if (current._type == LIST) {
+      _children[i]->append(word);
+    } else {
+      // Wraps instead of overflowing; the value itself is always in range.
+      long value = (long)((unsigned long)current._first +
+                          (unsigned long)current._step * _indexes[i]);
+      if (current._letters) {
+        word += (char)value;
+      } else {
+        char number[32];
+        snprintf(number, sizeof(number), "%0*ld", (int)current._width, value);
+        word += number;
+      }
+    }
+  }
+}
+
+BraceExpansion::BraceExpansion( const std::string & word, const std::string & literal ) {
+  _braces = parseSequence(word, literal, _word);
+  _started = false;
+}
+
+// Number of words the expansion generates (saturating at SIZE_MAX).
+size_t BraceExpansion::count() const {
+  return countSequence(_word);
+}
+
+// Store the next expanded word in word, reusing its buffer. Returns false
+// when there are no words left.
+bool BraceExpansion::next( std::string & word ) {
+  if (!_started) {
+    _cursor.reset(new Cursor(&_word));
+    _started = true;
+  } else if (!_cursor->advance()) {
+    return false;
+  }
+  word.clear();
+  _cursor->append(word);
+  return true;
+}
+
+// Maximum number of words a brace expansion may generate.
+size_t BraceExpansion::limit() {
+  std::string max_env;
+  if (!Environment::get("BRACE_MAX", max_env)) return DEFAULT_BRACE_MAX;
+  char * end;
+  unsigned long max = strtoul(max_env.c_str(), &end, 10);
+  if (end == max_env.c_str() || *end != '\0') return DEFAULT_BRACE_MAX;
+  return max == 0 ? SIZE_MAX : max;
+}
@@ -0,0 +1,67 @@
+#ifndef braceExpansion_hh
+#define braceExpansion_hh
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Brace Expansion Data Structure: parses the {a,b} lists and {1..N}
+// ranges of a word once and then generates the expanded words one at a
+// time, so large ranges never exist as a list of strings in memory.
+// Only the braces, commas and dots the user typed unquoted and unescaped
+// count: literal holds a flag per character of the word, '1' for the
+// characters that are kept as they are (see WordExpansion::expand).
+
+struct BraceExpansion {
+
+  struct Sequence;
+
+  enum ItemType { TEXT, LIST, RANGE };
+
+  // One part of a word: plain text, a list of alternatives (each of them a
+  // sequence that may contain braces of its own), or a numeric or letter
+  // range with a step and zero-padded width.
+  struct Item {
+    ItemType _type;
+    std::string _text;
+    std::vector<Sequence> _alternatives;
+    long _first;
+    long _step;
+    size_t _count;
+    size_t _width;
+    bool _letters;
+  };
+
+  struct Sequence {
+    std::vector<Item> _items;
+  };
+
+  // Position of the generator inside a sequence: the index reached in each
+  // of its items and, for lists, the position inside that alternative.
+  struct Cursor {
+    const Sequence * _sequence;
+    std::vector<size_t> _indexes;
+    std::vector<std::unique_ptr<Cursor>> _children;
+
+    Cursor( const Sequence * sequence );
+    void reset( size_t item );
+    bool advance();
+    void append( std::string & word ) const;
+  };
+
+  Sequence _word;
+  std::unique_ptr<Cursor> _cursor;
+  bool _started;
+  bool _braces;
+
+  BraceExpansion( const std::string & word, const std::string & literal );
+
+  bool hasBraces() const { return _braces; }
+  size_t count() const;
+  bool next( std::string & word );
+
+  static size_t limit();
+
+};
+
+#endif
@@ -0,0 +1,552 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <csignal>
+
+#include <algorithm>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "builtins.hh"
+#include "commandHash.hh"
+#include "dirCache.hh"
+#include "scriptCache.hh"
+#include "environment.hh"
+#include "functions.hh"
+#include "shell.hh"
+#include "subshell.hh"
+
+// Prototypes for imported functions
+int source_cmd(const char * filename);
+
+// Table of built-in commands, sorted by name so it can be binary searched.
+static constexpr Builtin builtin_table[] = {
+  { "[", Builtins::test },
+  { "cd", Builtins::cd },
+  { "echo", Builtins::echo },
+  { "export", Builtins::exportCmd },
+  { "false", Builtins::falseCmd },
+  { "globcache", Builtins::globcache },
+  { "hash", Builtins::hash },
+  { "printenv", Builtins::printenv },
+  { "printf", Builtins::printfCmd },
+  { "return", Builtins::returnCmd },
+  { "set", Builtins::set },
+  { "setenv", Builtins::setenv },
+  { "source", Builtins::source },
+  { "sourcecache", Builtins::sourcecache },
+  { "substcache", Builtins::substcache },
+  { "test", Builtins::test },
+  { "true", Builtins::trueCmd },
+  { "unset", Builtins::unset },
+  { "unsetenv", Builtins::unsetenv },
+};
+
+// Compile time string comparison used to check the table order.
+static constexpr int builtin_compare(const char * a, const char * b) {
+  while (*a && *a == *b) {a++; b++;}
+  return (unsigned char) *a - (unsigned char) *b;
+}
+
+static constexpr bool builtin_table_sorted() {
+  for (size_t i = 1; i < sizeof(builtin_table) / sizeof(builtin_table[0]); i++) {
+    if (builtin_compare(builtin_table[i - 1]._name, builtin_table[i]._name) >= 0) return false;
+  }
+  return true;
+}
+
+static_assert(builtin_table_sorted(), "builtin_table must be sorted by name");
+
+// Return the built-in with the given name, or NULL if there is none.
+const Builtin * Builtins::find( const char * name ) {
+  const Builtin * begin = std::begin(builtin_table);
+  const Builtin * end = std::end(builtin_table);
+  const Builtin * found = std::lower_bound(begin, end, name,
+    [](const Builtin & builtin, const char * key) {return strcmp(builtin._name, key) < 0;});
+  if (found == end || strcmp(found->_name, name) != 0) return NULL;
+  return found;
+}
+
+// Run a built-in inside the shell with fdin/fdout/fderr as its stdin,
+// stdout and stderr, then put the shell's own descriptors back. SIGPIPE is
+// ignored meanwhile so a reader that exits early cannot kill the shell.
+int Builtins::run( const Builtin * builtin, Command * command, SimpleCommand * simpleCommand,
+                   int fdin, int fdout, int fderr ) {
+  // Save and replace the shell's descriptors only when the built-in runs
+  // with different ones (in a pipeline or with a redirect).
+  bool redirected = fdin != 0 || fdout != 1 || fderr != 2;
+  int default_in = -1, default_out = -1, default_err = -1;
+  if (redirected) {
+    default_in = fcntl(0, F_DUPFD_CLOEXEC, 0);
+    default_out = fcntl(1, F_DUPFD_CLOEXEC, 0);
+    default_err = fcntl(2, F_DUPFD_CLOEXEC, 0);
+    dup2(fdin, 0);
+    dup2(fdout, 1);
+    dup2(fderr, 2);
+  }
+
+  struct sigaction ignore;
+  struct sigaction old_action;
+  ignore.sa_handler = SIG_IGN;
+  sigemptyset(&ignore.sa_mask);
+  ignore.sa_flags = 0;
+  sigaction(SIGPIPE, &ignore, &old_action);
+
+  int status = builtin->_function(command, simpleCommand);
+  fflush(stdout);
+  fflush(stderr);
+  clearerr(stdout);
+
+  sigaction(SIGPIPE, &old_action, NULL);
+
+  if (redirected) {
+    dup2(default_in, 0);
+    dup2(default_out, 1);
+    dup2(default_err, 2);
+    close(default_in);
+    close(default_out);
+    close(default_err);
+  }
+  return status;
+}
+
+// Change Directory Command: Defaults to home directory if no
+// arguments passed, throws error if directory not found.
+int Builtins::cd( Command *, SimpleCommand * simpleCommand ) {
+  int error;
+  if (simpleCommand->_arguments.size() == 1) {
+    std::string home;
+    Environment::get("HOME", home);
+    error = chdir(home.c_str());
+  } else {
+    error = chdir(simpleCommand->_arguments[1]->c_str());
+  }
+  if (error == -1) {
+    fprintf(stderr, "cd: can't cd to %s\n", simpleCommand->_arguments[1]->c_str());
+    return 1;
+  }
+  return 0;
+}
+
+// Glob Cache Command: reports the directory cache used by wildcard
+// expansion, or flushes it with -f.
+int Builtins::globcache( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() == 1) {
+    DirCache::print();
+  } else if (*simpleCommand->_arguments[1] == "-f") {
+    DirCache::clear();
+  } else {
+    fprintf(stderr, "globcache: usage: globcache [-f]\n");
+    return 1;
+  }
+  return 0;
+}
+
+// Source Cache Command: prints the script cache statistics, or forgets
+// every cached script (and its cache file) with -f.
+int Builtins::sourcecache( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() == 1) {
+    ScriptCache::print();
+  } else if (*simpleCommand->_arguments[1] == "-f") {
+    ScriptCache::clear();
+  } else {
+    fprintf(stderr, "sourcecache: usage: sourcecache [-f]\n");
+    return 1;
+  }
+  return 0;
+}
+
+// Hash Command: prints the remembered command paths and hit counts,
+// forgets them all with -r, or looks up the given command names.
+int Builtins::hash( Command *, SimpleCommand * simpleCommand ) {
+  int error = 0;
+  if (simpleCommand->_arguments.size() == 1) {
+    CommandHash::print();
+  } else if (*simpleCommand->_arguments[1] == "-r") {
+    CommandHash::clear();
+  } else {
+    for (size_t j = 1; j < simpleCommand->_arguments.size(); j++) {
+      std::string path;
+      if (!CommandHash::lookup(*simpleCommand->_arguments[j], path)) {
+        fprintf(stderr, "hash: %s: not found\n", simpleCommand->_arguments[j]->c_str());
+        error = 1;
+      }
+    }
+  }
+  return error;
+}
+
+// Print Enviroment Variable Command: prints the exported variables.
+int Builtins::printenv( Command *, SimpleCommand * ) {
+  Environment::print(true);
+  return 0;
+}
+
+// Export Command: with no arguments, prints the exported variables.
+// Otherwise exports each NAME (setting it first for NAME=value).
+int Builtins::exportCmd( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() == 1) {
+    Environment::print(true);
+    return 0;
+  }
+  for (size_t i = 1; i < simpleCommand->_arguments.size(); i++) {
+    std::string & word = *simpleCommand->_arguments[i];
+    if (Environment::isAssignment(word)) {
+      Environment::assign(word);
+      word = word.substr(0, word.find('='));
+    }
+    Environment::exportVariable(word);
+  }
+  return 0;
+}
+
+// Set Command: prints every variable, exported or local to the shell.
+int Builtins::set( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() != 1) {
+    fprintf(stderr, "set takes no arguments\n");
+    return 1;
+  }
+  Environment::print(false);
+  return 0;
+}
+
+// Set Environment Variable Command: throws error if three
+// arguemnts not given, sets and exports the variable.
+int Builtins::setenv( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() != 3) {
+    fprintf(stderr, "setenv requires three arguments\n");
+    return 1;
+  }
+  Environment::set(*simpleCommand->_arguments[1], *simpleCommand->_arguments[2]);
+  Environment::exportVariable(*simpleCommand->_arguments[1]);
+  return 0;
+}
+
+// Unset Command: removes each named variable, exported or local.
+int Builtins::unset( Command *, SimpleCommand * simpleCommand ) {
+  for (size_t i = 1; i < simpleCommand->_arguments.size(); i++) {
+    Environment::unset(*simpleCommand->_arguments[i]);
+  }
+  return 0;
+}
+
+// Unset Environment Variable Command: Removes environment
+// variable, throws error if two arguments not given.
+int Builtins::unsetenv( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() != 2) {
+    fprintf(stderr, "unsetenv requires one argument\n");
+    return 1;
+  }
+  Environment::unset(*simpleCommand->_arguments[1]);
+  return 0;
+}
+
+// Source command: calls source command in shell.l to parse given file
+// as input to the shell, with error handling.
+int Builtins::source( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() != 2) {
+    fprintf(stderr, "source requires two arguments\n");
+    return 1;
+  }
+  if (source_cmd(simpleCommand->_arguments[1]->c_str()) == -1) {
+    fprintf(stderr, "file not found\n");
+    return 1;
+  }
+  return 0;
+}
+
+// Substitution Cache Command: lists the cached command substitution
+// outputs, or forgets them all with -f.
+int Builtins::substcache( Command *, SimpleCommand * simpleCommand ) {
+  if (simpleCommand->_arguments.size() == 1) {
+    Subshell::printCache();
+  } else if (*simpleCommand->_arguments[1] == "-f") {
+    Subshell::clearCache();
+  } else {
+    fprintf(stderr, "substcache: usage: substcache [-f]\n");
+    return 1;
+  }
+  return 0;
+}
+
+// Return Command: ends the function being called, with the given status
+// or else that of the last command.
+int Builtins::returnCmd( Command *, SimpleCommand * simpleCommand ) {
+  if (Functions::_depth == 0) {
+    fprintf(stderr, "return: can only return from a function\n");
+    return 1;
+  }
+  Functions::_returning = true;
+  if (simpleCommand->_arguments.size() > 1) {
+    return atoi(simpleCommand->_arguments[1]->c_str()) & 0xff;
+  }
+  return Shell::_returnStatus;
+}
+
+// True/False Commands: only return a status.
+int Builtins::trueCmd( Command *, SimpleCommand * ) {
+  return 0;
+}
+
+int Builtins::falseCmd( Command *, SimpleCommand * ) {
+  return 1;
+}
+
+// Echo Command: prints its arguments separated by spaces, followed by a
+// newline unless -n is given.
+int Builtins::echo( Command *, SimpleCommand * simpleCommand ) {
+  std::vector<std::string *> & args = simpleCommand->_arguments;
+  size_t first = 1;
+  bool newline = true;
+  if (args.size() > 1 && *args[1] == "-n") {
+    newline = false;
+    first = 2;
+  }
+  for (size_t i = first; i < args.size(); i++) {
+    if (i > first) putchar(' ');
+    fputs(args[i]->c_str(), stdout);
+  }
+  if (newline) putchar('\n');
+  return 0;
+}
+
+// Print the backslash escape starting at *p (just after the backslash)
+// and return the number of characters it used.
+static int print_escape(const char * p) {
+  switch (*p) {
+    case 'n': putchar('\n'); return 1;
+    case 't': putchar('\t'); return 1;
+    case 'r': putchar('\r'); return 1;
+    case 'a': putchar('\a'); return 1;
+    case 'b': putchar('\b'); return 1;
+    case 'f': putchar('\f'); return 1;
+    case 'v': putchar('\v'); return 1;
+    case '\\': putchar('\\'); return 1;
+    case '0': {
+      int value = 0;
+      int used = 1;
+      while (used < 4 && p[used] >= '0' && p[used] <= '7') {
+        value = value * 8 + (p[used] - '0');
+        used++;
+      }
+      putchar(value);
+      return used;
+    }
+    case '\0': putchar('\\'); return 0;
+    default: putchar('\\'); putchar(*p); return 1;
+  }
+}
+
+// Printf Command: formats its arguments according to the format string
+// (conversions %s %b %c %d %i %u %o %x %X %%, with flags, width and
+// precision). The format is reused until every argument is consumed.
+int Builtins::printfCmd( Command *, SimpleCommand * simpleCommand ) {
+  std::vector<std::string *> & args = simpleCommand->_arguments;
+  if (args.size() < 2) {
+    fprintf(stderr, "printf: usage: printf format [arguments]\n");
+    return 1;
+  }
+  const char * format = args[1]->c_str();
+  size_t next = 2;
+  int status = 0;
+
+  do {
+    bool consumed = false;
+    for (const char * p = format; *p; p++) {
+      if (*p == '\\') {
+        p += print_escape(p + 1);
+        continue;
+      }
+      if (*p != '%') {
+        putchar(*p);
+        continue;
+      }
+      if (p[1] == '%') {
+        putchar('%');
+        p++;
+        continue;
+      }
+
+      // Copy the conversion specification (flags, width, precision).
+      std::string spec = "%";
+      p++;
+      while (*p && strchr("-+ #0123456789.", *p)) spec += *p++;
+      if (!*p) {
+        fprintf(stderr, "printf: missing format character\n");
+        return 1;
+      }
+
+      const char * arg = "";
+      if (next < args.size()) {
+        arg = args[next++]->c_str();
+        consumed = true;
+      }
+
+      char conversion = *p;
+      if (conversion == 'd' || conversion == 'i') {
+        char * end;
+        long long value = strtoll(arg, &end, 0);
+        if (*end) {fprintf(stderr, "printf: %s: invalid number\n", arg); status = 1;}
+        spec += "lld";
+        ::printf(spec.c_str(), value);
+      } else if (conversion == 'u' || conversion == 'o' || conversion == 'x' || conversion == 'X') {
+        char * end;
+        unsigned long long value = strtoull(arg, &end, 0);
+        if (*end) {fprintf(stderr, "printf: %s: invalid number\n", arg); status = 1;}
+        spec += "ll";
+        spec += conversion;
+        ::printf(spec.c_str(), value);
+      } else if (conversion == 'c') {
+        // An empty argument has no character to print (only the padding).
+        spec += *arg ? 'c' : 's';
+        if (*arg) ::printf(spec.c_str(), *arg);
+        else ::printf(spec.c_str(), "");
+      } else if (conversion == 's') {
+        spec += 's';
+        ::printf(spec.c_str(), arg);
+      } else if (conversion == 'b') {
+        for (const char * q = arg; *q; q++) {
+          if (*q == '\\') q += print_escape(q + 1);
+          else putchar(*q);
+        }
+      } else {
+        fprintf(stderr, "printf: %%%c: invalid directive\n", conversion);
+        return 1;
+      }
+    }
+    if (!consumed) break;
+  } while (next < args.size());
+
+  return status;
+}
+
+// Recursive descent evaluator for test expressions over args[pos, end).
+// Returns 1 for true, 0 for false and -1 for a syntax error.
+static int test_or(std::vector<std::string *> & args, size_t & pos, size_t end);
+
+static bool test_number(const std::string & str, long long & value) {
+  char * stop;
+  value = strtoll(str.c_str(), &stop, 10);
+  return !str.empty() && *stop == '\0';
+}
+
+static int test_primary(std::vector<std::string *> & args, size_t & pos, size_t end) {
+  if (pos >= end) return -1;
+  const std::string & op = *args[pos];
+
+  // Parenthesized expression
+  if (op == "(") {
+    pos++;
+    int result = test_or(args, pos, end);
+    if (pos >= end || *args[pos] != ")") return -1;
+    pos++;
+    return result;
+  }
+
+  // Binary operators: arg op arg
+  if (pos + 2 < end) {
+    const std::string & binop = *args[pos + 1];
+    if (binop == "=" || binop == "==" || binop == "!=" ||
+        binop == "-eq" || binop == "-ne" || binop == "-lt" ||
+        binop == "-le" || binop == "-gt" || binop == "-ge") {
+      const std::string & left = op;
+      const std::string & right = *args[pos + 2];
+      pos += 3;
+      if (binop == "=" || binop == "==") return left == right;
+      if (binop == "!=") return left != right;
+      long long a;
+      long long b;
+      if (!test_number(left, a) || !test_number(right, b)) {
+        fprintf(stderr, "test: integer expression expected\n");
+        return -1;
+      }
+      if (binop == "-eq") return a == b;
+      if (binop == "-ne") return a != b;
+      if (binop == "-lt") return a < b;
+      if (binop == "-le") return a <= b;
+      if (binop == "-gt") return a > b;
+      return a >= b;
+    }
+  }
+
+  // Unary operators: -op arg
+  if (op.size() == 2 && op[0] == '-' && pos + 1 < end && strchr("efdrwxszLhn", op[1])) {
+    const char * arg = args[pos + 1]->c_str();
+    pos += 2;
+    struct stat st;
+    switch (op[1]) {
+      case 'z': return *arg == '\0';
+      case 'n': return *arg != '\0';
+      case 'e': return stat(arg, &st) == 0;
+      case 'f': return stat(arg, &st) == 0 && S_ISREG(st.st_mode);
+      case 'd': return stat(arg, &st) == 0 && S_ISDIR(st.st_mode);
+      case 's': return stat(arg, &st) == 0 && st.st_size > 0;
+      case 'L':
+      case 'h': return lstat(arg, &st) == 0 && S_ISLNK(st.st_mode);
+      case 'r': return access(arg, R_OK) == 0;
+      case 'w': return access(arg, W_OK) == 0;
+      case 'x': return access(arg, X_OK) == 0;
+    }
+  }
+
+  // A single string is true if it is not empty
+  pos++;
+  return !op.empty();
+}
+
+static int test_not(std::vector<std::string *> & args, size_t & pos, size_t end) {
+  if (pos < end && *args[pos] == "!" && pos + 1 < end) {
+    pos++;
+    int result = test_not(args, pos, end);
+    return result == -1 ? -1 : !result;
+  }
+  return test_primary(args, pos, end);
+}
+
+static int test_and(std::vector<std::string *> & args, size_t & pos, size_t end) {
+  int result = test_not(args, pos, end);
+  while (result != -1 && pos < end && *args[pos] == "-a") {
+    pos++;
+    int right = test_not(args, pos, end);
+    result = right == -1 ? -1 : result && right;
+  }
+  return result;
+}
+
+static int test_or(std::vector<std::string *> & args, size_t & pos, size_t end) {
+  int result = test_and(args, pos, end);
+  while (result != -1 && pos < end && *args[pos] == "-o") {
+    pos++;
+    int right = test_and(args, pos, end);
+    result = right == -1 ? -1 : result || right;
+  }
+  return result;
+}
+
+// Test Command (also called as [, which must be closed by ]): evaluates
+// file, string and integer conditions. Returns 0 for true, 1 for false
+// and 2 for an invalid expression.
+int Builtins::test( Command *, SimpleCommand * simpleCommand ) {
+  std::vector<std::string *> & args = simpleCommand->_arguments;
+  size_t end = args.size();
+  if (*args[0] == "[") {
+    if (*args[end - 1] != "]") {
+      fprintf(stderr, "[: missing ]\n");
+      return 2;
+    }
+    end--;
+  }
+
+  // No expression is false
+  size_t pos = 1;
+  if (pos == end) return 1;
+
+  int result = test_or(args, pos, end);
+  if (result == -1 || pos != end) {
+    fprintf(stderr, "test: syntax error\n");
+    return 2;
+  }
+  return result ? 0 : 1;
+}
@@ -0,0 +1,44 @@
+#ifndef builtins_hh
+#define builtins_hh
+
+#include "command.hh"
+
+// Built-in commands run inside the shell process itself, with the shell's
+// stdin/stdout/stderr pointed at the command's redirections. Each one
+// returns its exit status.
+
+typedef int (*BuiltinFunction)( Command * command, SimpleCommand * simpleCommand );
+
+struct Builtin {
+  const char * _name;
+  BuiltinFunction _function;
+};
+
+struct Builtins {
+
+  static const Builtin * find( const char * name );
+  static int run( const Builtin * builtin, Command * command, SimpleCommand * simpleCommand,
+                  int fdin, int fdout, int fderr );
+
+  static int cd( Command * command, SimpleCommand * simpleCommand );
+  static int echo( Command * command, SimpleCommand * simpleCommand );
+  static int exportCmd( Command * command, SimpleCommand * simpleCommand );
+  static int falseCmd( Command * command, SimpleCommand * simpleCommand );
+  static int globcache( Command * command, SimpleCommand * simpleCommand );
+  static int hash( Command * command, SimpleCommand * simpleCommand );
+  static int printenv( Command * command, SimpleCommand * simpleCommand );
+  static int printfCmd( Command * command, SimpleCommand * simpleCommand );
+  static int returnCmd( Command * command, SimpleCommand * simpleCommand );
+  static int set( Command * command, SimpleCommand * simpleCommand );
+  static int setenv( Command * command, SimpleCommand * simpleCommand );
+  static int source( Command * command, SimpleCommand * simpleCommand );
+  static int sourcecache( Command * command, SimpleCommand * simpleCommand );
+  static int substcache( Command * command, SimpleCommand * simpleCommand );
+  static int test( Command * command, SimpleCommand * simpleCommand );
+  static int trueCmd( Command * command, SimpleCommand * simpleCommand );
+  static int unset( Command * command, SimpleCommand * simpleCommand );
+  static int unsetenv( Command * command, SimpleCommand * simpleCommand );
+
+};
+
+#endif
@@ -0,0 +1,132 @@
+#include "bytecode.hh"
+#include "environment.hh"
+
+// Append the instructions of a command line's syntax tree to the program.
+void Program::compile( const Node * node ) {
+  switch (node->_type) {
+  case Node::LIST:
+    for (auto & child : node->_children) compile(child);
+    break;
+  case Node::PIPELINE:
+    compilePipeline(node);
+    break;
+  case Node::IF:
+    compileIf(node);
+    break;
+  case Node::WHILE:
+    compileWhile(node);
+    break;
+  case Node::FOR:
+    compileFor(node);
+    break;
+  case Node::FUNCTION:
+    emit(Instruction::FUNCTION, _functions.size());
+    _functions.push_back({node->_name, node->_body});
+    break;
+  }
+}
+
+// Compile a pipeline. Words that expansion would leave unchanged become
+// literal arguments. A lone foreground simple command without
+// redirections whose name is a built-in calls it directly, and one made
+// only of literal NAME=value words assigns them directly; both skip the
+// descriptor setup of SPAWN.
+void Program::compilePipeline( const Node * node ) {
+  emit(Instruction::PIPELINE, node->_background);
+  for (auto & simpleCommand : node->_commands) {
+    emit(Instruction::COMMAND);
+    for (auto & word : simpleCommand._words) compileWord(word);
+  }
+  for (auto & redirect : node->_redirects) {
+    emit(Instruction::REDIRECT, _redirects.size());
+    _redirects.push_back(redirect);
+  }
+
+  const std::vector<Word> & words = node->_commands[0]._words;
+  bool alone = node->_commands.size() == 1 && node->_redirects.empty() && !node->_background;
+  const Builtin * builtin = NULL;
+  bool assignments = alone;
+  if (alone && isLiteral(words[0])) builtin = Builtins::find(words[0]._text.c_str());
+  for (auto & word : words) {
+    if (!isLiteral(word) || !Environment::isAssignment(word._text)) assignments = false;
+  }
+
+  if (assignments) {
+    emit(Instruction::ASSIGN);
+  } else if (builtin) {
+    emit(Instruction::BUILTIN, _builtins.size());
+    _builtins.push_back(builtin);
+  } else {
+    emit(Instruction::SPAWN);
+  }
+  emit(Instruction::WAIT);
+}
+
+// Compile an if: each condition branches past its body when it fails,
+// and each body jumps to the end. Without an else, the status is 0 when
+// no body runs.
+void Program::compileIf( const Node * node ) {
+  const std::vector<Node *> & children = node->_children;
+  std::vector<size_t> ends;
+  size_t i = 0;
+  for (; i + 1 < children.size(); i += 2) {
+    compile(children[i]);
+    size_t branch = emit(Instruction::BRANCH);
+    compile(children[i + 1]);
+    ends.push_back(emit(Instruction::JUMP));
+    _code[branch]._operand = _code.size();
+  }
+  if (i < children.size()) compile(children[i]);
+  else emit(Instruction::STATUS, 0);
+  for (size_t end : ends) _code[end]._operand = _code.size();
+}
+
+// Compile a while loop: WHILE, the condition, TEST, the body and a LOOP
+// back to the condition.
+void Program::compileWhile( const Node * node ) {
+  emit(Instruction::WHILE);
+  size_t start = _code.size();
+  compile(node->_children[0]);
+  size_t test = emit(Instruction::TEST);
+  compile(node->_children[1]);
+  emit(Instruction::LOOP, start);
+  _code[test]._operand = _code.size();
+}
+
+// Compile a for loop: a COMMAND with the words to loop over, FOR, then
+// NEXT, the body and a LOOP back to NEXT.
+void Program::compileFor( const Node * node ) {
+  emit(Instruction::COMMAND, 1);
+  for (auto & word : node->_words) compileWord(word);
+  emit(Instruction::FOR, _strings.size());
+  _strings.push_back(node->_name);
+  size_t next = emit(Instruction::NEXT);
+  compile(node->_children[0]);
+  emit(Instruction::LOOP, next);
+  _code[next]._operand = _code.size();
+}
+
+// Compile a word of a simple command: a literal argument if expansion
+// would leave it unchanged, otherwise a word to expand.
+void Program::compileWord( const Word & word ) {
+  if (isLiteral(word)) {
+    emit(Instruction::LITERAL, _strings.size());
+    _strings.push_back(word._text);
+  } else {
+    emit(Instruction::EXPAND, _words.size());
+    _words.push_back(word);
+  }
+}
+
+// Append an instruction and return its position.
+size_t Program::emit( Instruction::Opcode opcode, unsigned operand ) {
+  _code.push_back({opcode, operand});
+  return _code.size() - 1;
+}
+
+// A word is literal if expanding it gives back its own text: it has no
+// quotes, variables, tilde, escapes, substitutions, braces or wildcards.
+bool Program::isLiteral( const Word & word ) {
+  return word._kind == Word::UNQUOTED &&
+         word._text.find_first_of("\"'`$~\\{*?[") == std::string::npos;
+}
@@ -0,0 +1,68 @@
+#ifndef bytecode_hh
+#define bytecode_hh
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ast.hh"
+#include "builtins.hh"
+
+// Bytecode Data Structure: a script compiled from its syntax trees into a
+// flat list of instructions, so running it is a single loop over them
+// instead of walking the tree. Every pipeline compiles to one straight
+// sequence: PIPELINE, then COMMAND and its arguments for each simple
+// command, its redirections, SPAWN (or BUILTIN/ASSIGN) and finally WAIT.
+// Control flow compiles to jumps around the code of its conditions and
+// bodies; a for loop starts with a COMMAND holding its word list. Function
+// bodies are kept as syntax trees, which the executor runs when called.
+
+struct Instruction {
+  enum Opcode {
+    PIPELINE,   // start a command; the operand is 1 if it runs in the background
+    COMMAND,    // start a simple command in it; the operand is 1 for a for loop's word list
+    LITERAL,    // add _strings[operand], which needs no expansion, as an argument
+    EXPAND,     // expand _words[operand] into arguments
+    REDIRECT,   // expand the target of _redirects[operand] and set it
+    BUILTIN,    // run _builtins[operand] with the shell's own descriptors
+    ASSIGN,     // set the variables of the NAME=value arguments
+    SPAWN,      // launch every simple command of the command
+    WAIT,       // wait for a foreground command, then clear it
+    JUMP,       // continue at instruction operand
+    BRANCH,     // continue at instruction operand if the last command failed
+    STATUS,     // set the status of the last command to operand
+    FOR,        // start a loop setting _strings[operand] to each argument of the simple command
+    NEXT,       // set the variable to the next value, or end the loop and continue at operand
+    WHILE,      // start a loop that runs while its condition succeeds
+    TEST,       // end the loop and continue at operand if the condition failed
+    LOOP,       // keep the status of the loop body and continue at operand
+    FUNCTION,   // define the function _functions[operand]
+  };
+
+  Opcode _opcode;
+  unsigned _operand;
+};
+
+struct Program {
+  std::vector<Instruction> _code;
+
+  // Operands of the instructions.
+  std::vector<std::string> _strings;
+  std::vector<Word> _words;
+  std::vector<Redirect> _redirects;
+  std::vector<const Builtin *> _builtins;
+  std::vector<std::pair<std::string, std::shared_ptr<const Node>>> _functions;
+
+  void compile( const Node * node );
+  void compilePipeline( const Node * node );
+  void compileIf( const Node * node );
+  void compileWhile( const Node * node );
+  void compileFor( const Node * node );
+  size_t emit( Instruction::Opcode opcode, unsigned operand = 0 );
+  void compileWord( const Word & word );
+
+  static bool isLiteral( const Word & word );
+};
+
+#endif
@@ -6,17 +6,20 @@
 #include <sys/wait.h>
 #include <fcntl.h>
 #include <cstring>
+#include <csignal>
+#include <cerrno>
 
 #include "command.hh"
 #include "shell.hh"
-
-
-// Prototypes for imported functions
-int yyparse(void);
-int source_cmd(const char * filename);
-
-// Initialize global environ array and _lastArgument string
-extern char ** environ;
+#include "spawn.hh"
+#include "pipeline.hh"
+#include "commandHash.hh"
+#include "environment.hh"
+#include "argBatch.hh"
+#include "builtins.hh"
+#include "functions.hh"
+
+// Initialize global _lastArgument string
 std::string _lastArgument;
 
 Command::Command() {
@@ -107,12 +110,22 @@ void Command::print() {
 }
 
 void Command::execute() {
-    // Base Case: Prompt and return if there are no simple commands
+    // Base Case: Return if there are no simple commands
     if ( _simpleCommands.size() == 0 ) {
-        Shell::prompt();
         return;
     }
- 
+
+    // Initialize pipeline to track the process ID and exit status of
+    // every simple command launched, start every stage and wait for them.
+    Pipeline pipeline(_simpleCommands.size());
+    launch(pipeline);
+    wait(pipeline);
+}
+
+// Start every simple command of the command, connected by pipes, recording
+// each stage in pipeline. Built-ins and assignments finish before this
+// returns; child processes are left running for wait() to collect.
+void Command::launch( Pipeline & pipeline ) {
     // Initialize command name variable to check for special commands
     const char * cmd = _simpleCommands[0]->_arguments[0]->c_str();
 
@@ -123,200 +136,239 @@ void Command::execute() {
        exit(0);
     }
  
-    // Initialize process ID variable
-    int ret = 0;
+    size_t n = _simpleCommands.size();
+
+    // A lone foreground function call, assignment or built-in without
+    // redirections runs with the shell's own descriptors, so none need to
+    // be set up.
+    if (n == 1 && !_background && !_inFile && !_outFile && !_errFile) {
+       bool assignments = true;
+       for (auto & arg : _simpleCommands[0]->_arguments) {
+          if (!Environment::isAssignment(*arg)) {assignments = false; break;}
+       }
+       const Builtin * builtin = NULL;
+       if (assignments) {
+          assign(pipeline);
+          return;
+       } else if (Functions::find(cmd)) {
+          _lastArgument = std::string(*_simpleCommands[0]->_arguments.back());
+          pipeline.setStatus(0, Functions::call(_simpleCommands[0]));
+          return;
+       } else if ((builtin = Builtins::find(cmd))) {
+          call(builtin, pipeline);
+          return;
+       }
+    }
 
-    // Initialize default stdin/stdout/stderr file descriptors
-    int default_in = dup(0);
-    int default_out = dup(1);
-    int default_err = dup(2);
+    // Initialize default stdin/stdout/stderr file descriptors. All descriptors
+    // the shell opens for a command are close-on-exec so that spawned children
+    // only inherit the ones installed as their stdin/stdout/stderr.
+    int default_in = fcntl(0, F_DUPFD_CLOEXEC, 0);
+    int default_out = fcntl(1, F_DUPFD_CLOEXEC, 0);
+    int default_err = fcntl(2, F_DUPFD_CLOEXEC, 0);
 
-    // Initialize command file descriptors
-    int fdin;
-    int fdout;
+    // Initialize input/output file descriptors of every simple command
+    std::vector<int> fdin(n);
+    std::vector<int> fdout(n);
     int fderr;
 
     // Set initial fdin value based on input file
-    if (_inFile) {fdin = open(_inFile->c_str(), O_RDONLY);}
-    else {fdin = dup(default_in);}
-
-    // Set initial fderr value based one error fiel
-    if (_errFile && _append) {fderr = open(_errFile->c_str(), O_WRONLY | O_CREAT | O_APPEND , 0600);}
-    else if (_errFile) {fderr = open(_errFile->c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);}
-    else {fderr = dup(default_err);}
+    if (_inFile) {fdin[0] = open(_inFile->c_str(), O_RDONLY | O_CLOEXEC);}
+    else {fdin[0] = fcntl(default_in, F_DUPFD_CLOEXEC, 0);}
 
-    // Direct fderr descriptor to stderr and close
-    dup2(fderr, 2);
-    close(fderr);
-
-    // Loop through and execute each simple command from given command
-    for (size_t i = 0; i < _simpleCommands.size(); i++) {
+    // Set final fdout value based on output file
+    if (_outFile && _append) {fdout[n - 1] = open(_outFile->c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0600);}
+    else if (_outFile) {fdout[n - 1] = open(_outFile->c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);}
+    else {fdout[n - 1] = fcntl(default_out, F_DUPFD_CLOEXEC, 0);}
 
-	// Direct fdin descriptor to stdin and close
-	dup2(fdin, 0);
-	close(fdin);
+    // Set initial fderr value based one error fiel
+    if (_errFile && _append) {fderr = open(_errFile->c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0600);}
+    else if (_errFile) {fderr = open(_errFile->c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);}
+    else {fderr = fcntl(default_err, F_DUPFD_CLOEXEC, 0);}
+
+    // Set up and initialize a pipe between each pair of consecutive simple
+    // commands to pass output forward.
+    for (size_t i = 0; i + 1 < n; i++) {
+       int fdpipe[2];
+       if (pipe2(fdpipe, O_CLOEXEC) == -1) {
+          perror("pipe");
+          exit(2);
+       }
+       fdout[i] = fdpipe[1];
+       fdin[i + 1] = fdpipe[0];
+    }
 
-	// Set _lastArgument command to the last element in the _arguments vector for
-	// current simple command.
-	_lastArgument = std::string(*_simpleCommands[i]->_arguments.back());
+    // Set _lastArgument command to the last element in the _arguments vector for
+    // the last simple command.
+    _lastArgument = std::string(*_simpleCommands[n - 1]->_arguments.back());
 
-	// If at the last simple command, direct final output to _outFile
-	// Otherwise, set up and initialize pipe to pass output forward
-        if (i == _simpleCommands.size() - 1) {
-	   if (_outFile && _append) {fdout = open(_outFile->c_str(), O_WRONLY | O_CREAT | O_APPEND, 0600);}
-	   else if (_outFile) {fdout = open(_outFile->c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);}
-	   else {fdout = dup(default_out);}
-	} else {
-	   int fdpipe[2];
-	   if (pipe(fdpipe) == -1) {
-	      perror("pipe");
-	      exit(2);
-	   }
-	   fdout = fdpipe[1];
-	   fdin = fdpipe[0];
-	}
+    // Only a lone foreground command runs inside the shell. In a pipeline
+    // or in the background, built-ins and functions run in a forked copy of
+    // the shell, so a stage can neither block the shell on a pipe whose
+    // writer is not started yet nor change the shell's own state (cd dir |
+    // cat), and assignments have no effect.
+    bool alone = n == 1 && !_background;
 
-	// Direct fdout descriptor to stdout and close
-	dup2(fdout, 1);
-	close(fdout);
+    // Loop through and execute each simple command from given command, from
+    // the last one to the first.
+    for (size_t i = n; i-- > 0; ) {
 
 	// Update cmd variable to current simple command name
         cmd = _simpleCommands[i]->_arguments[0]->c_str();
 
         // EXECUTING COMMANDS: During either built-in or child process execution,
-	// return status will be updated for reference in built-in environmental 
-	// variables and the shell.
-
-	// Change Directory Command: Defaults to home directory if no
-	// arguments passed, throws error if directory not found.
-        if ( strcmp(cmd, "cd") == 0 ) {
-            int error;
-	    if (_simpleCommands[i]->_arguments.size() == 1) {
-              error = chdir(getenv("HOME"));
-            } else {
-              error = chdir(_simpleCommands[i]->_arguments[1]->c_str());
-            }
-            if (error == -1) {
-              fprintf(stderr, "cd: can't cd to %s\n", _simpleCommands[i]->_arguments[1]->c_str());
-	      if (!_background) Shell::_returnStatus = 1;
-	    } else {if (!_background) Shell::_returnStatus = 0;}
-	// Set Environment Variable Command: Stays in parent process, throws
-	// error if three arguemnts not given, utilizes setenv().
-        } else if ( strcmp(cmd, "setenv") == 0 ) {
-	     if (_simpleCommands[i]->_arguments.size() != 3) {
-	        fprintf(stderr, "setenv requires three arguments\n");
-                if (!_background) Shell::_returnStatus = 1;
-	     } else {
-		const char * A = _simpleCommands[i]->_arguments[1]->c_str();
-                const char * B = _simpleCommands[i]->_arguments[2]->c_str();
-                int error = setenv(A, B, 1);
-		if (!_background) Shell::_returnStatus = error;
-	     }
-	// Unset Environment Variable Command: Removes environment
-	// variable, stays in parent process, throws error if two 
-	// arguments not given.
-        } else if ( strcmp(cmd, "unsetenv") == 0 ) { 
-             if (_simpleCommands[i]->_arguments.size() != 2) {
-	        fprintf(stderr, "unsetenv requires one argument\n");
-                if (!_background) Shell::_returnStatus = 1;
-	     } else {
-                int error = unsetenv(_simpleCommands[i]->_arguments[1]->c_str());
-                if (!_background) Shell::_returnStatus = error;
-	     }
-	// Source command: calls source command in shell.l to parse given file
-	// as input to the shell, with error handling.
-        } else if ( strcmp(cmd, "source") == 0 ) {
-	    if (_simpleCommands[i]->_arguments.size() != 2) {
-	      fprintf(stderr, "source requires two arguments\n");
-              if (!_background) Shell::_returnStatus = 1;
-	      clear();
-	      break;
-	    }
-	    char * filename = strdup(_simpleCommands[i]->_arguments[1]->c_str());
-	    std::vector<SimpleCommand *> _tempCommands = std::vector<SimpleCommand *>();
-	    for (auto & sc : _simpleCommands) {
-	      delete sc;
-	    }
-	    _simpleCommands.clear();
-	    if (source_cmd(filename) == -1) {
-	      fprintf(stderr, "file not found\n");
-              if (!_background) Shell::_returnStatus = 1;
-	      clear();
-	    } else {
-	      if (!_background) Shell::_returnStatus = 0;
-	    }
-            free(filename);
-	    for (size_t i = 0; i < _tempCommands.size(); i++) {
-	      _simpleCommands.push_back(_tempCommands.at(i));
-	    }
-            dup2(fdin, 0);
-   	    close(fdin);
-	// All other commands (not built-in): crate child process and call execvp
-	} else {	
-          ret = fork();
-	  // Child process created
+	// the return status is recorded in the pipeline for reference in built-in
+	// environmental variables and the shell.
+
+	// Variable assignments: a simple command made only of NAME=value
+	// words sets those variables in the shell.
+	bool assignments = true;
+	for (auto & arg : _simpleCommands[i]->_arguments) {
+	  if (!Environment::isAssignment(*arg)) {assignments = false; break;}
+	}
+	bool function = !assignments && Functions::find(cmd);
+	const Builtin * builtin = assignments || function ? NULL : Builtins::find(cmd);
+	if (assignments) {
+	  if (alone) {
+	    for (auto & arg : _simpleCommands[i]->_arguments) Environment::assign(*arg);
+	  }
+	  pipeline.setStatus(i, 0);
+	// A lone function call or built-in runs inside the shell with this
+	// command's descriptors.
+	} else if (function && alone) {
+	  pipeline.setStatus(i, Functions::run(_simpleCommands[i], fdin[i], fdout[i], fderr));
+	} else if (builtin && alone) {
+	  pipeline.setStatus(i, Builtins::run(builtin, this, _simpleCommands[i],
+	                                       fdin[i], fdout[i], fderr));
+	// Otherwise a forked copy of the shell runs it (without exec) with
+	// this command's descriptors, after closing the ones of the stages not
+	// launched yet.
+	} else if (function || builtin) {
+	  fflush(stdout);
+	  pid_t ret = fork();
 	  if (ret == 0) {
-	    // Print Enviroment Variable Command
-            if ( strcmp(cmd, "printenv") == 0 ) {
-              char ** env = environ;
-              while(*env) {
-	        printf("%s\n", *env);
-                env++;
-	      }
-	      if (!_background) Shell::_returnStatus = 0;
-	      exit(0);
-	    // Source Command: Throws error if file not given,
-	    // calls source_cmd function found in shell.l
-            } else {
-	      // Create arrray of arguments compatible with execvp and 
-	      // pass in all arguments from current simple command.
-	      std::vector<char *> execvp_array = std::vector<char *>();
-	      for (unsigned int j = 0; j < _simpleCommands[i]->_arguments.size(); j++) {
-	        execvp_array.push_back(const_cast<char *>(_simpleCommands[i]->_arguments[j]->c_str()));
-	      }
-              
-	      // Push NULL argument and call execvp to execute command.
-	      execvp_array.push_back(NULL);
-	      execvp(execvp_array[0], execvp_array.data());
-	  
-	      // If execvp does not execute, throw error and exit
-	      // NOTE: _exit(1), not exit() used.
-	      perror("execvp");
-              if (!_background) Shell::_returnStatus = 1;
-	      _exit(1);
+	    dup2(fdin[i], 0);
+	    dup2(fdout[i], 1);
+	    dup2(fderr, 2);
+	    for (size_t j = 0; j <= i; j++) {
+	      close(fdin[j]);
+	      close(fdout[j]);
 	    }
-	  // If ret is negative, fork did not execute correctly. Throw error.
+	    close(fderr);
+	    close(default_in);
+	    close(default_out);
+	    close(default_err);
+	    Shell::_bkgPipelines.clear();
+	    Shell::_bkgPIDs.clear();
+	    int status = function ? Functions::call(_simpleCommands[i]) :
+	                            Builtins::run(builtin, this, _simpleCommands[i], 0, 1, 2);
+	    fflush(stdout);
+	    _exit(status);
 	  } else if (ret < 0) {
-	      perror("fork");
-	      if (!_background) Shell::_returnStatus = 2;
-	      exit(2);
+	    perror("fork");
+	    pipeline.setStatus(i, 1);
+	  } else {
+	    pipeline.setProcess(i, ret);
+	  }
+	// All other commands (not built-in): spawn the program directly with
+	// this command's descriptors, without forking the shell.
+	} else {
+	  // Create arrray of arguments compatible with exec and
+	  // pass in all arguments from current simple command.
+	  std::vector<char *> exec_array = std::vector<char *>();
+	  for (unsigned int j = 0; j < _simpleCommands[i]->_arguments.size(); j++) {
+	    exec_array.push_back(const_cast<char *>(_simpleCommands[i]->_arguments[j]->c_str()));
+	  }
+	  exec_array.push_back(NULL);
+
+	  // Resolve the program through the command hash table and launch it.
+	  // If a remembered path no longer exists, forget it and search PATH
+	  // again once. If the program could not be executed, throw error.
+	  pid_t ret = -1;
+	  std::string path;
+	  if (CommandHash::lookup(exec_array[0], path)) {
+	    ret = Spawn::launch(path.c_str(), exec_array.data(), fdin[i], fdout[i], fderr);
+	    if (ret < 0 && errno == ENOENT && CommandHash::_table.count(exec_array[0])) {
+	      CommandHash::forget(exec_array[0]);
+	      if (CommandHash::lookup(exec_array[0], path)) {
+	        ret = Spawn::launch(path.c_str(), exec_array.data(), fdin[i], fdout[i], fderr);
+	      }
+	    }
+	  } else {
+	    errno = ENOENT;
 	  }
 
+	  // If the expanded arguments are too long for one exec and batching
+	  // is enabled, split them across several execs of the program.
+	  SimpleCommand * sc = _simpleCommands[i];
+	  if (ret < 0 && errno == E2BIG && !sc->_expanded.empty() && ArgBatch::jobs() > 0) {
+	    ret = ArgBatch::launch(path.c_str(), exec_array, sc->_expanded,
+	                           fdin, fdout, i, fderr);
+	  }
+	  if (ret < 0) {
+	    perror("execvp");
+	    pipeline.setStatus(i, 1);
+	  } else {
+	    pipeline.setProcess(i, ret);
+	  }
 	}
+
+	// The child (if any) holds its own copies now; close the shell's
+	// descriptors for this command.
+	close(fdin[i]);
+	close(fdout[i]);
     }
 
-    // Direct stdin/stdout/stderr back to defaults.
-    dup2(default_in, 0);
-    dup2(default_out, 1);
-    dup2(default_err, 2);
+    // Close the error descriptor shared by every command.
+    close(fderr);
 
     // Close temporary file descriptors
     close(default_in);
     close(default_out);
     close(default_err);
+}
+
+// Run a lone built-in with the shell's own stdin/stdout/stderr, skipping
+// the descriptor setup launch() does for pipes and redirects.
+void Command::call( const Builtin * builtin, Pipeline & pipeline ) {
+    _lastArgument = std::string(*_simpleCommands[0]->_arguments.back());
+    pipeline.setStatus(0, Builtins::run(builtin, this, _simpleCommands[0], 0, 1, 2));
+}
+
+// Run a lone simple command made only of NAME=value words, setting
+// those variables in the shell.
+void Command::assign( Pipeline & pipeline ) {
+    _lastArgument = std::string(*_simpleCommands[0]->_arguments.back());
+    for (auto & arg : _simpleCommands[0]->_arguments) Environment::assign(*arg);
+    pipeline.setStatus(0, 0);
+}
 
-    // If process not a background process, wait for child process to complete
-    // Otherwise, continue running and add the PID to the background process
-    // tracking data structure. Additionally, handle the return status.
+// Finish a launched command: wait for a foreground pipeline or hand a
+// background one to the shell, then clear the command.
+void Command::wait( Pipeline & pipeline ) {
+    // If process not a background process, wait for every stage of the
+    // pipeline to complete and keep the status of each one. Otherwise,
+    // continue running and add the pipeline to the background process
+    // tracking data structures (SIGCHLD is blocked while they change, since
+    // the handler reaps from them). Additionally, handle the return status.
     if (!_background) {
-       int status;
-       waitpid(ret, &status, 0);
-       Shell::_returnStatus = WEXITSTATUS(status);
-       char * custom_error = getenv("ON_ERROR");
-       if (custom_error != NULL && Shell::_returnStatus != 0) printf("%s\n", custom_error);
-    } else {
-       Shell::_bkgPIDs.push_back(ret);
-       Shell::_lastBkgProcess = ret;
+       pipeline.wait();
+       Shell::_pipeStatus = pipeline._statuses;
+       Shell::_returnStatus = pipeline.lastStatus();
+       std::string custom_error;
+       if (Environment::get("ON_ERROR", custom_error) && Shell::_returnStatus != 0) {
+         printf("%s\n", custom_error.c_str());
+       }
+    } else if (pipeline.lastPid() > 0) {
+       sigset_t mask;
+       sigset_t old_mask;
+       sigemptyset(&mask);
+       sigaddset(&mask, SIGCHLD);
+       sigprocmask(SIG_BLOCK, &mask, &old_mask);
+       Shell::_bkgPipelines.push_back(pipeline);
+       Shell::_bkgPIDs.push_back(pipeline.lastPid());
+       Shell::_lastBkgProcess = pipeline.lastPid();
+       sigprocmask(SIG_SETMASK, &old_mask, NULL);
     }
 
     // Print contents of Command data structure
@@ -324,9 +376,4 @@ void Command::execute() {
 
     // Clear to prepare for next command
     clear();
-
-    // Print new prompt
-    Shell::prompt();
 }
-
-SimpleCommand * Command::_currentSimpleCommand;
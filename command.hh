@@ -3,6 +3,9 @@
 
 #include "simpleCommand.hh"
 
+struct Builtin;
+struct Pipeline;
+
 // Command Data Structure
 
 struct Command {
@@ -15,13 +18,15 @@ struct Command {
 
   Command();
   void insertSimpleCommand( SimpleCommand * simpleCommand );
-  std::string getLastArgument();
+  static std::string getLastArgument();
 
   void clear();
   void print();
   void execute();
-
-  static SimpleCommand *_currentSimpleCommand;
+  void launch( Pipeline & pipeline );
+  void call( const Builtin * builtin, Pipeline & pipeline );
+  void assign( Pipeline & pipeline );
+  void wait( Pipeline & pipeline );
 };
 
 #endif
@@ -0,0 +1,87 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "commandHash.hh"
+#include "environment.hh"
+
+// Find the absolute path of a command, consulting the hash table first
+// and walking PATH only on a miss. Names containing a slash are used as
+// they are. Returns false if the command cannot be found.
+bool CommandHash::lookup(const std::string & name, std::string & path) {
+  if (name.find('/') != std::string::npos) {
+    path = name;
+    return true;
+  }
+
+  // Hit: return the remembered path.
+  auto entry = _table.find(name);
+  if (entry != _table.end()) {
+    _hits++;
+    entry->second._hits++;
+    path = entry->second._path;
+    return true;
+  }
+
+  // Miss: search PATH and remember the result.
+  _misses++;
+  if (!resolve(name, path)) return false;
+  _table[name] = Entry{path, 1};
+  return true;
+}
+
+// Walk the directories of PATH (an empty component means the current
+// directory) and return the first executable regular file called name.
+bool CommandHash::resolve(const std::string & name, std::string & path) {
+  std::string dirs;
+  if (!Environment::get("PATH", dirs)) dirs = "/usr/local/bin:/usr/bin:/bin";
+
+  size_t start = 0;
+  while (start <= dirs.size()) {
+    size_t end = dirs.find(':', start);
+    if (end == std::string::npos) end = dirs.size();
+
+    std::string candidate = dirs.substr(start, end - start);
+    if (candidate.empty()) candidate = ".";
+    candidate += "/" + name;
+
+    struct stat st;
+    if (stat(candidate.c_str(), &st) == 0 && S_ISREG(st.st_mode) &&
+        access(candidate.c_str(), X_OK) == 0) {
+      path = candidate;
+      return true;
+    }
+    start = end + 1;
+  }
+  return false;
+}
+
+// Drop one remembered command (e.g. its file disappeared).
+void CommandHash::forget(const std::string & name) {
+  _table.erase(name);
+}
+
+// Drop every remembered command (e.g. PATH changed).
+void CommandHash::clear() {
+  _table.clear();
+}
+
+// Print the remembered commands with their hit counts, followed by the
+// totals for the whole table.
+void CommandHash::print() {
+  if (_table.empty()) {
+    printf("hash: hash table empty\n");
+  } else {
+    printf("hits\tcommand\n");
+    for (auto & entry : _table) {
+      printf("%4d\t%s\n", entry.second._hits, entry.second._path.c_str());
+    }
+  }
+  printf("%d hits, %d misses\n", _hits, _misses);
+}
+
+std::unordered_map<std::string, CommandHash::Entry> CommandHash::_table;
+int CommandHash::_hits;
+int CommandHash::_misses;
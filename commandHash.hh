@@ -0,0 +1,28 @@
+#ifndef commandhash_hh
+#define commandhash_hh
+
+#include <string>
+#include <unordered_map>
+
+// Command Hash Data Structure: remembers the absolute path each command
+// name resolved to in PATH, so PATH is only walked once per command.
+
+struct CommandHash {
+
+  struct Entry {
+    std::string _path;
+    int _hits;
+  };
+
+  static bool lookup(const std::string & name, std::string & path);
+  static bool resolve(const std::string & name, std::string & path);
+  static void forget(const std::string & name);
+  static void clear();
+  static void print();
+
+  static std::unordered_map<std::string, Entry> _table;
+  static int _hits;
+  static int _misses;
+};
+
+#endif
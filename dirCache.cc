@@ -0,0 +1,73 @@
+#include <cstdio>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "dirCache.hh"
+
+// Return the entry names of the directory at path, or NULL if it cannot be
+// read. A cached listing is used when the directory is the same inode with
+// the same modification time as when it was read. Listings of directories
+// modified within a timestamp tick of when they were read are not kept,
+// since a change within the same tick would leave the time unchanged.
+DirListing DirCache::list( const std::string & path ) {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) return NULL;
+
+  auto cached = _cache.find(path);
+  if (cached != _cache.end() && cached->second._dev == st.st_dev &&
+      cached->second._ino == st.st_ino &&
+      cached->second._mtime.tv_sec == st.st_mtim.tv_sec &&
+      cached->second._mtime.tv_nsec == st.st_mtim.tv_nsec) {
+    _hits++;
+    return cached->second._names;
+  }
+  _misses++;
+
+  // Read the clock before the directory, so a change made while it is
+  // read is newer than the listing.
+  struct timespec now;
+  clock_gettime(CLOCK_REALTIME, &now);
+
+  DIR * dir = opendir(path.c_str());
+  if (dir == NULL) return NULL;
+  auto names = std::make_shared<std::vector<std::string>>();
+  struct dirent * ent;
+  while ( (ent = readdir(dir)) != NULL ) {
+    names->push_back(ent->d_name);
+  }
+  closedir(dir);
+
+  // File systems stamp changes from the coarse kernel clock, or to the
+  // whole second when their timestamps have no nanoseconds.
+  struct timespec tick;
+  clock_getres(CLOCK_REALTIME_COARSE, &tick);
+  long long granularity = st.st_mtim.tv_nsec == 0 ? 1000000000LL :
+                          tick.tv_sec * 1000000000LL + tick.tv_nsec;
+  long long age = (now.tv_sec - st.st_mtim.tv_sec) * 1000000000LL +
+                  (now.tv_nsec - st.st_mtim.tv_nsec);
+  if (age > granularity) {
+    _cache[path] = Entry{st.st_dev, st.st_ino, st.st_mtim, names};
+  } else {
+    _cache.erase(path);
+  }
+  return names;
+}
+
+// Print the number of cached directories and the hit rate.
+void DirCache::print() {
+  long total = _hits + _misses;
+  printf("%zu directories cached, %ld hits, %ld misses (%.1f%% hit rate)\n",
+         _cache.size(), _hits, _misses, total ? 100.0 * _hits / total : 0.0);
+}
+
+// Forget every cached directory and reset the counters.
+void DirCache::clear() {
+  _cache.clear();
+  _hits = 0;
+  _misses = 0;
+}
+
+std::unordered_map<std::string, DirCache::Entry> DirCache::_cache;
+long DirCache::_hits;
+long DirCache::_misses;
@@ -0,0 +1,35 @@
+#ifndef dircache_hh
+#define dircache_hh
+
+#include <ctime>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <sys/types.h>
+
+// Directory Cache Data Structure: remembers the entry names of directories
+// read during wildcard expansion, so expanding the same patterns again
+// against unchanged directories does not rescan them.
+
+typedef std::shared_ptr<const std::vector<std::string>> DirListing;
+
+struct DirCache {
+
+  struct Entry {
+    dev_t _dev;
+    ino_t _ino;
+    struct timespec _mtime;
+    DirListing _names;
+  };
+
+  static DirListing list( const std::string & path );
+  static void print();
+  static void clear();
+
+  static std::unordered_map<std::string, Entry> _cache;
+  static long _hits;
+  static long _misses;
+};
+
+#endif
@@ -0,0 +1,123 @@
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "dirWalker.hh"
+
+// Largest number of worker threads used for one walk.
+#define DIRWALKER_MAX_THREADS 8
+
+// Return every directory below root, relative to it and starting with ""
+// for root itself. Hidden directories and symbolic links are not entered.
+// The order is unspecified; callers sort the final expansion anyway.
+//
+// Each worker owns a queue of directories: it pushes the subdirectories
+// it finds onto the back of its own queue and takes work from the back,
+// and when its queue is empty it steals from the front of another
+// worker's queue; with no queue to steal from either it sleeps until
+// more directories are queued or the walk is over. Directories are
+// opened with openat() relative to the root and classified by d_type, so
+// no stat() is needed on most file systems.
+std::vector<std::string> DirWalker::walk( const std::string & root ) {
+  std::vector<std::string> result;
+  int rootfd = open(root.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (rootfd == -1) return result;
+
+  unsigned int nthreads = std::thread::hardware_concurrency();
+  if (nthreads == 0) nthreads = 1;
+  if (nthreads > DIRWALKER_MAX_THREADS) nthreads = DIRWALKER_MAX_THREADS;
+
+  std::vector<Queue> queues(nthreads);
+  std::vector<std::vector<std::string>> found(nthreads);
+  std::atomic<long> pending(1);
+  std::atomic<long> queued(1);
+  queues[0]._dirs.push_back("");
+
+  // Idle workers wait on work_ready. Waking them takes idle_lock first, so
+  // a worker that has just found no work is either already waiting or
+  // sees the new counts before it waits.
+  std::mutex idle_lock;
+  std::condition_variable work_ready;
+  auto wake = [&]() {
+    { std::lock_guard<std::mutex> guard(idle_lock); }
+    work_ready.notify_all();
+  };
+
+  auto worker = [&](unsigned int id) {
+    while (pending.load() > 0) {
+      // Take the newest directory from our own queue, or steal the
+      // oldest one from another worker.
+      std::string dir;
+      bool have = false;
+      for (unsigned int k = 0; k < nthreads && !have; k++) {
+        Queue & queue = queues[(id + k) % nthreads];
+        std::lock_guard<std::mutex> guard(queue._lock);
+        if (queue._dirs.empty()) continue;
+        if (k == 0) {
+          dir = std::move(queue._dirs.back());
+          queue._dirs.pop_back();
+        } else {
+          dir = std::move(queue._dirs.front());
+          queue._dirs.pop_front();
+        }
+        queued--;
+        have = true;
+      }
+      if (!have) {
+        std::unique_lock<std::mutex> guard(idle_lock);
+        work_ready.wait(guard, [&] { return queued.load() > 0 || pending.load() == 0; });
+        continue;
+      }
+
+      // Read the directory and queue its subdirectories.
+      found[id].push_back(dir);
+      int fd = dir.empty() ? fcntl(rootfd, F_DUPFD_CLOEXEC, 0) :
+               openat(rootfd, dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW);
+      DIR * d = fd == -1 ? NULL : fdopendir(fd);
+      if (d == NULL) {
+        if (fd != -1) close(fd);
+        if (--pending == 0) wake();
+        continue;
+      }
+
+      bool pushed = false;
+      struct dirent * ent;
+      while ((ent = readdir(d)) != NULL) {
+        if (ent->d_name[0] == '.') continue;
+        bool is_dir = ent->d_type == DT_DIR;
+        if (ent->d_type == DT_UNKNOWN) {
+          struct stat st;
+          is_dir = fstatat(dirfd(d), ent->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0 &&
+                   S_ISDIR(st.st_mode);
+        }
+        if (!is_dir) continue;
+
+        std::string sub = dir.empty() ? ent->d_name : dir + "/" + ent->d_name;
+        pending++;
+        std::lock_guard<std::mutex> guard(queues[id]._lock);
+        queues[id]._dirs.push_back(std::move(sub));
+        queued++;
+        pushed = true;
+      }
+      closedir(d);
+      if (pushed) wake();
+      if (--pending == 0) wake();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned int i = 1; i < nthreads; i++) threads.emplace_back(worker, i);
+  worker(0);
+  for (auto & thread : threads) thread.join();
+  close(rootfd);
+
+  for (auto & list : found) {
+    for (auto & dir : list) result.push_back(std::move(dir));
+  }
+  return result;
+}
@@ -0,0 +1,25 @@
+#ifndef dirwalker_hh
+#define dirwalker_hh
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Directory Walker Data Structure: lists every directory below a root
+// (used for ** in wildcards) with a pool of threads that steal work from
+// each other.
+
+struct DirWalker {
+
+  // Directories (relative to the root) waiting to be read by one worker.
+  struct Queue {
+    std::mutex _lock;
+    std::deque<std::string> _dirs;
+  };
+
+  static std::vector<std::string> walk( const std::string & root );
+
+};
+
+#endif
@@ -0,0 +1,194 @@
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+
+#include "environment.hh"
+#include "commandHash.hh"
+
+extern char ** environ;
+
+std::vector<Environment::Slot> Environment::_slots;
+size_t Environment::_count = 0;
+size_t Environment::_occupied = 0;
+bool Environment::_loaded = false;
+bool Environment::_dirty = true;
+std::vector<std::string> Environment::_entries;
+std::vector<char *> Environment::_environ;
+
+// Smallest number of slots the table starts with (a power of two).
+#define MIN_SLOTS 64
+
+// FNV-1a hash of a variable name.
+static size_t hashName( const std::string & name ) {
+  size_t hash = 14695981039346656037ULL;
+  for (unsigned char c : name) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// Find the slot holding name, or -1. Probing stops at the first slot that
+// was never used.
+static long findSlot( const std::string & name, size_t hash ) {
+  std::vector<Environment::Slot> & slots = Environment::_slots;
+  if (slots.empty()) return -1;
+  size_t mask = slots.size() - 1;
+  for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+    Environment::Slot & slot = slots[i];
+    if (!slot._used && !slot._removed) return -1;
+    if (slot._used && slot._hash == hash && slot._name == name) return i;
+  }
+}
+
+// Resize the table to hold at least twice the variables it has, dropping
+// the removed markers.
+static void rehash() {
+  size_t size = MIN_SLOTS;
+  while (size < (Environment::_count + 1) * 2) size *= 2;
+  std::vector<Environment::Slot> old(size);
+  old.swap(Environment::_slots);
+  size_t mask = size - 1;
+  for (auto & slot : old) {
+    if (!slot._used) continue;
+    size_t i = slot._hash & mask;
+    while (Environment::_slots[i]._used) i = (i + 1) & mask;
+    Environment::_slots[i] = std::move(slot);
+  }
+  Environment::_occupied = Environment::_count;
+}
+
+// Insert a new variable (name must not be in the table yet) and return
+// its slot. The table is kept at most 70% full, counting removed markers.
+static Environment::Slot & insertSlot( const std::string & name, size_t hash ) {
+  if ((Environment::_occupied + 1) * 10 > Environment::_slots.size() * 7) rehash();
+  size_t mask = Environment::_slots.size() - 1;
+  size_t i = hash & mask;
+  while (Environment::_slots[i]._used) i = (i + 1) & mask;
+  Environment::Slot & slot = Environment::_slots[i];
+  if (!slot._removed) Environment::_occupied++;
+  slot._name = name;
+  slot._hash = hash;
+  slot._used = true;
+  slot._removed = false;
+  slot._exported = false;
+  Environment::_count++;
+  return slot;
+}
+
+// Import the environment the shell was started with, all exported.
+static void load() {
+  Environment::_loaded = true;
+  for (char ** env = ::environ; *env; env++) {
+    const char * equals = strchr(*env, '=');
+    if (!equals) continue;
+    std::string name(*env, equals - *env);
+    Environment::set(name, equals + 1);
+    Environment::exportVariable(name);
+  }
+}
+
+// Copy the value of a variable into value. Returns false if it is not set.
+// The value is copied because the slot may move when the table is resized
+// or be overwritten by the next assignment.
+bool Environment::get( const std::string & name, std::string & value ) {
+  if (!_loaded) load();
+  long i = findSlot(name, hashName(name));
+  if (i < 0) return false;
+  value = _slots[i]._value;
+  return true;
+}
+
+// Set a variable. New variables are local to the shell; variables that
+// were exported stay exported.
+void Environment::set( const std::string & name, const std::string & value ) {
+  if (!_loaded) load();
+  size_t hash = hashName(name);
+  long i = findSlot(name, hash);
+  Slot & slot = (i < 0) ? insertSlot(name, hash) : _slots[i];
+  slot._value = value;
+  if (slot._exported) _dirty = true;
+  if (name == "PATH") CommandHash::clear();
+}
+
+// Pass a variable on to programs started by the shell (creating it empty
+// if it is not set).
+void Environment::exportVariable( const std::string & name ) {
+  if (!_loaded) load();
+  size_t hash = hashName(name);
+  long i = findSlot(name, hash);
+  Slot & slot = (i < 0) ? insertSlot(name, hash) : _slots[i];
+  if (!slot._exported) _dirty = true;
+  slot._exported = true;
+}
+
+// Remove a variable. Returns false if it was not set.
+bool Environment::unset( const std::string & name ) {
+  if (!_loaded) load();
+  long i = findSlot(name, hashName(name));
+  if (i < 0) return false;
+  Slot & slot = _slots[i];
+  if (slot._exported) _dirty = true;
+  slot._used = false;
+  slot._removed = true;
+  slot._name.clear();
+  slot._value.clear();
+  _count--;
+  if (name == "PATH") CommandHash::clear();
+  return true;
+}
+
+// Return true if word has the form NAME=value with a valid variable name.
+bool Environment::isAssignment( const std::string & word ) {
+  size_t equals = word.find('=');
+  if (equals == 0 || equals == std::string::npos) return false;
+  if (isdigit((unsigned char) word[0])) return false;
+  for (size_t i = 0; i < equals; i++) {
+    if (!isalnum((unsigned char) word[i]) && word[i] != '_') return false;
+  }
+  return true;
+}
+
+// Set the variable of a NAME=value word.
+void Environment::assign( const std::string & word ) {
+  size_t equals = word.find('=');
+  set(word.substr(0, equals), word.substr(equals + 1));
+}
+
+// Return the environ array of the exported variables, rebuilding it only
+// if an exported variable changed. The process environ is pointed at it
+// as well, so library code reading the environment sees the same values.
+char ** Environment::environ() {
+  if (!_loaded) load();
+  if (_dirty) {
+    _entries.clear();
+    for (auto & slot : _slots) {
+      if (slot._used && slot._exported) _entries.push_back(slot._name + "=" + slot._value);
+    }
+    _environ.clear();
+    for (auto & entry : _entries) _environ.push_back(const_cast<char *>(entry.c_str()));
+    _environ.push_back(NULL);
+    ::environ = _environ.data();
+    _dirty = false;
+  }
+  return _environ.data();
+}
+
+// Print the variables as NAME=value lines: only the exported ones, or all
+// of them sorted by name.
+void Environment::print( bool exported ) {
+  if (exported) {
+    for (char ** env = environ(); *env; env++) printf("%s\n", *env);
+    return;
+  }
+  if (!_loaded) load();
+  std::vector<const Slot *> variables;
+  for (auto & slot : _slots) {
+    if (slot._used) variables.push_back(&slot);
+  }
+  std::sort(variables.begin(), variables.end(),
+    [](const Slot * a, const Slot * b) {return a->_name < b->_name;});
+  for (auto slot : variables) printf("%s=%s\n", slot->_name.c_str(), slot->_value.c_str());
+}
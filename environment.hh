@@ -0,0 +1,44 @@
+#ifndef environment_hh
+#define environment_hh
+
+#include <string>
+#include <vector>
+
+// Environment Data Structure: the shell's own table of variables, an open
+// addressing hash table so ${VAR} lookups do not scan environ. Variables
+// are either exported (passed to programs) or local to the shell. The
+// environ array handed to programs is only rebuilt when an exported
+// variable changed since it was last built.
+
+struct Environment {
+
+  // A slot of the table. Unset variables leave a removed marker behind so
+  // probing continues past them.
+  struct Slot {
+    std::string _name;
+    std::string _value;
+    size_t _hash;
+    bool _used;
+    bool _removed;
+    bool _exported;
+  };
+
+  static bool get( const std::string & name, std::string & value );
+  static void set( const std::string & name, const std::string & value );
+  static void exportVariable( const std::string & name );
+  static bool unset( const std::string & name );
+  static bool isAssignment( const std::string & word );
+  static void assign( const std::string & word );
+  static char ** environ();
+  static void print( bool exported );
+
+  static std::vector<Slot> _slots;
+  static size_t _count;
+  static size_t _occupied;
+  static bool _loaded;
+  static bool _dirty;
+  static std::vector<std::string> _entries;
+  static std::vector<char *> _environ;
+};
+
+#endif
@@ -0,0 +1,324 @@
+#include <cstdio>
+
+#include "executor.hh"
+#include "arithmetic.hh"
+#include "environment.hh"
+#include "functions.hh"
+#include "shell.hh"
+#include "subshell.hh"
+#include "wildcard.hh"
+#include "wordExpansion.hh"
+
+// Prototypes for imported functions
+bool parse_command(Node *& node);
+
+int Executor::_running = 0;
+
+// Parse and run the command lines of the current input one at a time until
+// it ends, printing a prompt after each one. A Ctrl-C pressed before a
+// command line starts does not stop it. Returns the status of the last
+// command.
+int Executor::runInput() {
+  Node * node;
+  while (parse_command(node)) {
+    if (node) {
+      if (_running == 0) Shell::_interrupted = 0;
+      _running++;
+      run(node);
+      _running--;
+      delete node;
+    }
+    Shell::prompt();
+  }
+  return Shell::_returnStatus;
+}
+
+// Run a node of the syntax tree.
+void Executor::run( const Node * node ) {
+  switch (node->_type) {
+  case Node::LIST:
+    for (auto & child : node->_children) {
+      if (interrupted()) break;
+      run(child);
+      if (Functions::_returning) break;
+    }
+    break;
+  case Node::PIPELINE:
+    runPipeline(node);
+    break;
+  case Node::IF:
+    runIf(node);
+    break;
+  case Node::WHILE:
+    runWhile(node);
+    break;
+  case Node::FOR:
+    runFor(node);
+    break;
+  case Node::FUNCTION:
+    Functions::define(node->_name, node->_body);
+    Shell::_returnStatus = 0;
+    break;
+  }
+}
+
+// Run the body of the first if/elif whose condition succeeds, or the else
+// body if none does. With no body run, the status is 0.
+void Executor::runIf( const Node * node ) {
+  const std::vector<Node *> & children = node->_children;
+  size_t i = 0;
+  for (; i + 1 < children.size(); i += 2) {
+    run(children[i]);
+    if (Functions::_returning) return;
+    if (Shell::_returnStatus == 0) {
+      run(children[i + 1]);
+      return;
+    }
+  }
+  if (i < children.size()) run(children[i]);
+  else Shell::_returnStatus = 0;
+}
+
+// Return true (with status 130) if Ctrl-C was pressed while the current
+// command line runs. The flag stays set, so every enclosing loop and list
+// stops as well.
+bool Executor::interrupted() {
+  if (!Shell::_interrupted) return false;
+  Shell::_returnStatus = 130;
+  return true;
+}
+
+// Run the body for as long as the condition succeeds. The status is that
+// of the last body run, or 0 if it never ran.
+void Executor::runWhile( const Node * node ) {
+  int status = 0;
+  for (;;) {
+    if (interrupted()) return;
+    run(node->_children[0]);
+    if (Functions::_returning) return;
+    if (Shell::_returnStatus != 0) break;
+    run(node->_children[1]);
+    status = Shell::_returnStatus;
+    if (Functions::_returning) return;
+  }
+  Shell::_returnStatus = status;
+}
+
+// Expand the words of a for loop (including wildcards and substitutions)
+// and run the body once with the variable set to each of them. The
+// status is that of the last body run, or 0 if it never ran.
+void Executor::runFor( const Node * node ) {
+  LoopValues values;
+  for (auto & word : node->_words) {
+    if (!expandLoopWord(word, values)) {
+      fprintf(stderr, "syntax error\n");
+      Shell::_returnStatus = 1;
+      return;
+    }
+  }
+  Shell::_returnStatus = 0;
+  std::string value;
+  while (values.next(value)) {
+    if (interrupted()) return;
+    Environment::set(node->_name, value);
+    run(node->_children[0]);
+    if (Functions::_returning) break;
+  }
+}
+
+// Expand the words of a pipeline into a Command and execute it. If a word
+// cannot be expanded, the pipeline does not run.
+void Executor::runPipeline( const Node * node ) {
+  Command command;
+  for (auto & simpleCommandNode : node->_commands) {
+    SimpleCommand * simpleCommand = new SimpleCommand();
+    for (auto & word : simpleCommandNode._words) {
+      if (!expandWord(word, simpleCommand)) {
+        fprintf(stderr, "syntax error\n");
+        delete simpleCommand;
+        command.clear();
+        Shell::_returnStatus = 1;
+        return;
+      }
+    }
+    // A command made only of substitutions with no output runs nothing.
+    if (simpleCommand->_arguments.empty()) {
+      delete simpleCommand;
+      continue;
+    }
+    command.insertSimpleCommand(simpleCommand);
+  }
+
+  // Expand the redirection targets.
+  for (auto & redirect : node->_redirects) {
+    if (!Executor::redirect(redirect, command)) {
+      fprintf(stderr, "syntax error\n");
+      command.clear();
+      Shell::_returnStatus = 1;
+      return;
+    }
+  }
+
+  command._background = node->_background;
+  command.execute();
+}
+
+// Expand the target of redirect and set it on command. A second
+// redirection of the same stream is ambiguous and ignored. Returns false
+// if the target could not be expanded.
+bool Executor::redirect( const Redirect & redirect, Command & command ) {
+  std::string target;
+  if (!expandText(redirect._target, target)) return false;
+  bool out = redirect._type != Redirect::IN && redirect._type != Redirect::ERR;
+  bool err = redirect._type == Redirect::OUT_ERR || redirect._type == Redirect::APPEND_ERR ||
+             redirect._type == Redirect::ERR;
+  if (redirect._type == Redirect::IN) {
+    if (command._inFile) fprintf(stderr, "Ambiguous input redirect.\n");
+    else command._inFile = new std::string(target);
+  } else if (out && command._outFile) {
+    fprintf(stderr, "Ambiguous output redirect.\n");
+  } else if (err && command._errFile) {
+    fprintf(stderr, "Ambiguous error redirect.\n");
+  } else {
+    std::string * file = new std::string(target);
+    if (out) command._outFile = file;
+    if (err) command._errFile = file;
+    if (redirect._type == Redirect::APPEND || redirect._type == Redirect::APPEND_ERR) {
+      command._append = true;
+    }
+  }
+  return true;
+}
+
+// A substitution whose command is in parentheses, $((expression)), is
+// arithmetic and is evaluated in the shell.
+static bool isArithmetic( const Word & word ) {
+  return word._kind == Word::SUBSTITUTION && word._text.size() >= 2 &&
+         word._text.front() == '(' && word._text.back() == ')';
+}
+
+// Expand a word into arguments of simpleCommand. A command substitution
+// runs its command and adds each space separated part of the output;
+// "${@}" adds the positional parameters; other words (arithmetic too)
+// are expanded into one argument. Every argument after the command name (every one, if
+// command is false) also goes through wildcard expansion, and through
+// brace expansion if the word has unquoted braces of its own (never the
+// output of a substitution or the value of a variable).
+// Returns false if the word could not be expanded.
+bool Executor::expandWord( const Word & word, SimpleCommand * simpleCommand, bool command ) {
+  // "${@}" gives one argument per positional parameter.
+  if (word._kind == Word::QUOTED && word._text == "\"${@}\"") {
+    for (size_t i = 1; i < Shell::_arguments.size(); i++) {
+      simpleCommand->insertArgument(new std::string(Shell::_arguments[i]));
+    }
+    return true;
+  }
+
+  if (word._kind != Word::SUBSTITUTION || isArithmetic(word)) {
+    std::string * text = new std::string();
+    std::string literal;
+    bool braces = word._text.find('{') != std::string::npos;
+    if (!expandText(word, *text, braces ? &literal : NULL)) {
+      delete text;
+      return false;
+    }
+    if (command && simpleCommand->_arguments.empty()) simpleCommand->insertArgument(text);
+    else if (braces) expandWildcardsIfNecessary(text, literal, simpleCommand);
+    else expandWildcards(text, simpleCommand);
+    return true;
+  }
+
+  std::string output = Subshell::substitute(word._text);
+  size_t start = output.find_first_not_of(" \t");
+  while (start != std::string::npos) {
+    size_t end = output.find_first_of(" \t", start);
+    if (end == std::string::npos) end = output.size();
+    std::string * part = new std::string(output, start, end - start);
+    if (command && simpleCommand->_arguments.empty()) simpleCommand->insertArgument(part);
+    else expandWildcards(part, simpleCommand);
+    start = output.find_first_not_of(" \t", end);
+  }
+  return true;
+}
+
+// Expand a word of a for loop into values. A word with braces is only
+// expanded into text; its brace expansion is left to generate the values
+// as the loop runs (with no BRACE_MAX limit, since they are never all in
+// memory).
+bool Executor::expandLoopWord( const Word & word, LoopValues & values ) {
+  SimpleCommand words;
+  bool arguments = word._kind == Word::QUOTED && word._text == "\"${@}\"";
+  if (!arguments && (word._kind != Word::SUBSTITUTION || isArithmetic(word))) {
+    std::string * text = new std::string();
+    std::string literal;
+    bool braces = word._text.find('{') != std::string::npos;
+    if (!expandText(word, *text, braces ? &literal : NULL)) {
+      delete text;
+      return false;
+    }
+    if (braces && text->find('{') != std::string::npos) {
+      std::unique_ptr<BraceExpansion> braces(new BraceExpansion(*text, literal));
+      if (braces->hasBraces()) {
+        values._parts.emplace_back();
+        values._parts.back()._braces = std::move(braces);
+        delete text;
+        return true;
+      }
+    }
+    expandWildcards(text, &words);
+  } else if (!expandWord(word, &words, false)) {
+    return false;
+  }
+  for (auto & argument : words._arguments) values.add(std::move(*argument));
+  return true;
+}
+
+// Add a value after the values added so far.
+void LoopValues::add( std::string value ) {
+  if (_parts.empty() || _parts.back()._braces) _parts.emplace_back();
+  _parts.back()._values.push_back(std::move(value));
+}
+
+// Store the next value of the loop in value, generating the next words of
+// a brace expansion when the values before them are used up. Returns
+// false when there are no values left.
+bool LoopValues::next( std::string & value ) {
+  while (_part < _parts.size()) {
+    Part & part = _parts[_part];
+    if (_next < part._values.size()) {
+      value = std::move(part._values[_next++]);
+      return true;
+    }
+    part._values.clear();
+    _next = 0;
+    std::string word;
+    if (part._braces && part._braces->next(word)) {
+      SimpleCommand words;
+      expandWildcards(new std::string(word), &words);
+      for (auto & argument : words._arguments) part._values.push_back(std::move(*argument));
+      continue;
+    }
+    _part++;
+  }
+  return false;
+}
+
+// Expand a word that is not a command substitution into text: variables,
+// tilde, quotes, escapes and arithmetic. If literal is given, it flags
+// the characters of text that are not brace syntax (see BraceExpansion).
+// Returns false on a syntax error in the word.
+bool Executor::expandText( const Word & word, std::string & text, std::string * literal ) {
+  if (isArithmetic(word)) {
+    text.clear();
+    if (!Arithmetic::evaluate(word._text.substr(1, word._text.size() - 2), text)) return false;
+    if (literal) literal->assign(text.size(), '1');
+    return true;
+  }
+  if (word._kind == Word::SUBSTITUTION) {
+    text = Subshell::substitute(word._text);
+    if (literal) literal->assign(text.size(), '1');
+    return true;
+  }
+  return WordExpansion::expand(word._text.data(), word._text.size(),
+                               word._kind == Word::QUOTED, text, literal);
+}
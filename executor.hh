@@ -0,0 +1,53 @@
+#ifndef executor_hh
+#define executor_hh
+
+#include <memory>
+
+#include "ast.hh"
+#include "braceExpansion.hh"
+#include "command.hh"
+
+// Executor: runs the syntax tree the parser builds for each command line.
+// Words are expanded when their node runs, and each pipeline is turned
+// into a Command with its arguments and redirections filled in.
+
+// Values of a for loop. Its words are expanded when the loop starts, but
+// the words a brace expansion generates (and their wildcards) only when
+// the loop reaches them, so a loop over {1..100000000} holds one value at
+// a time.
+struct LoopValues {
+
+  // A word of the list: its values, or the brace expansion generating them.
+  struct Part {
+    std::vector<std::string> _values;
+    std::unique_ptr<BraceExpansion> _braces;
+  };
+
+  std::vector<Part> _parts;
+  size_t _part;
+  size_t _next;
+
+  LoopValues() : _part(0), _next(0) {}
+  void add( std::string value );
+  bool next( std::string & value );
+};
+
+struct Executor {
+
+  static int runInput();
+  static void run( const Node * node );
+  static void runPipeline( const Node * node );
+  static void runIf( const Node * node );
+  static void runWhile( const Node * node );
+  static void runFor( const Node * node );
+  static bool expandWord( const Word & word, SimpleCommand * simpleCommand, bool command = true );
+  static bool expandLoopWord( const Word & word, LoopValues & values );
+  static bool expandText( const Word & word, std::string & text, std::string * literal = NULL );
+  static bool redirect( const Redirect & redirect, Command & command );
+  static bool interrupted();
+
+  // Number of command lines currently running (nested by source).
+  static int _running;
+};
+
+#endif
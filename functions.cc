@@ -0,0 +1,74 @@
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "functions.hh"
+#include "executor.hh"
+#include "shell.hh"
+
+std::unordered_map<std::string, std::shared_ptr<const Node>> Functions::_table;
+int Functions::_depth = 0;
+bool Functions::_returning = false;
+
+// Define (or redefine) the function name.
+void Functions::define( const std::string & name, std::shared_ptr<const Node> body ) {
+  _table[name] = body;
+}
+
+// Return the body of the function name, or NULL if there is none.
+std::shared_ptr<const Node> Functions::find( const std::string & name ) {
+  if (_table.empty()) return NULL;
+  auto entry = _table.find(name);
+  if (entry == _table.end()) return NULL;
+  return entry->second;
+}
+
+// Call the function named by the first argument of simpleCommand with the
+// rest as its positional parameters (${0} is kept), and restore the
+// caller's afterwards. The body is held while it runs, so the function
+// can redefine itself. Returns the status of the last command run.
+int Functions::call( SimpleCommand * simpleCommand ) {
+  std::shared_ptr<const Node> body = find(*simpleCommand->_arguments[0]);
+  if (!body) return 127;
+
+  std::vector<std::string> arguments;
+  arguments.reserve(simpleCommand->_arguments.size());
+  arguments.push_back(Shell::_arguments.empty() ? "" : Shell::_arguments[0]);
+  for (size_t i = 1; i < simpleCommand->_arguments.size(); i++) {
+    arguments.push_back(*simpleCommand->_arguments[i]);
+  }
+  arguments.swap(Shell::_arguments);
+
+  _depth++;
+  Executor::run(body.get());
+  _depth--;
+  _returning = false;
+
+  Shell::_arguments.swap(arguments);
+  return Shell::_returnStatus;
+}
+
+// Call a function inside the shell with fdin/fdout/fderr as its stdin,
+// stdout and stderr, then put the shell's own descriptors back.
+int Functions::run( SimpleCommand * simpleCommand, int fdin, int fdout, int fderr ) {
+  int default_in = fcntl(0, F_DUPFD_CLOEXEC, 0);
+  int default_out = fcntl(1, F_DUPFD_CLOEXEC, 0);
+  int default_err = fcntl(2, F_DUPFD_CLOEXEC, 0);
+  fflush(stdout);
+  dup2(fdin, 0);
+  dup2(fdout, 1);
+  dup2(fderr, 2);
+
+  int status = call(simpleCommand);
+  fflush(stdout);
+  fflush(stderr);
+
+  dup2(default_in, 0);
+  dup2(default_out, 1);
+  dup2(default_err, 2);
+  close(default_in);
+  close(default_out);
+  close(default_err);
+  return status;
+}
@@ -0,0 +1,31 @@
+#ifndef functions_hh
+#define functions_hh
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "ast.hh"
+#include "command.hh"
+
+// Functions: shell functions defined with name() { ... }, kept in a hash
+// table as their parsed bodies so a call neither reads nor parses any
+// text. A call runs the body inside the shell with the arguments as the
+// positional parameters ${1}, ${2}, ... until it ends or runs return.
+
+struct Functions {
+
+  static void define( const std::string & name, std::shared_ptr<const Node> body );
+  static std::shared_ptr<const Node> find( const std::string & name );
+  static int call( SimpleCommand * simpleCommand );
+  static int run( SimpleCommand * simpleCommand, int fdin, int fdout, int fderr );
+
+  static std::unordered_map<std::string, std::shared_ptr<const Node>> _table;
+
+  // Number of function calls in progress, and whether return was run in
+  // the innermost one.
+  static int _depth;
+  static bool _returning;
+};
+
+#endif
@@ -0,0 +1,115 @@
+#include <cerrno>
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+
+#include "pipeline.hh"
+
+Pipeline::Pipeline( size_t stages ) {
+  _pids = std::vector<pid_t>(stages, 0);
+  _statuses = std::vector<int>(stages, 0);
+}
+
+// Record a stage running as a child process.
+void Pipeline::setProcess( size_t stage, pid_t pid ) {
+  _pids[stage] = pid;
+  _statuses[stage] = -1;
+}
+
+// Record a stage that already finished inside the shell (built-ins, or
+// commands that could not be launched) with its exit status.
+void Pipeline::setStatus( size_t stage, int status ) {
+  _pids[stage] = 0;
+  _statuses[stage] = status;
+}
+
+// Convert a waitpid() status into a shell exit status: the exit code for
+// normal termination, 128 + signal number for killed processes.
+int Pipeline::exitStatus( int status ) {
+  if (WIFSIGNALED(status)) return 128 + WTERMSIG(status);
+  return WEXITSTATUS(status);
+}
+
+// Block until every stage has exited. Each child gets a pidfd and all of
+// them are collected with a single poll() loop, so the shell wakes up
+// exactly once per exiting stage. Kernels without pidfd_open fall back to
+// a blocking waitpid() per stage.
+void Pipeline::wait() {
+  std::vector<struct pollfd> fds;
+  std::vector<size_t> stages;
+
+  for (size_t i = 0; i < _pids.size(); i++) {
+    if (_pids[i] <= 0 || _statuses[i] != -1) continue;
+    int fd = -1;
+#ifdef SYS_pidfd_open
+    fd = syscall(SYS_pidfd_open, _pids[i], 0);
+#endif
+    if (fd == -1) {
+      int status = 0;
+      while (waitpid(_pids[i], &status, 0) == -1 && errno == EINTR);
+      _statuses[i] = exitStatus(status);
+      continue;
+    }
+    fds.push_back({fd, POLLIN, 0});
+    stages.push_back(i);
+  }
+
+  // A pidfd becomes readable when its process exits; reap those stages
+  // and drop them from the poll set until none are left.
+  while (!fds.empty()) {
+    if (poll(fds.data(), fds.size(), -1) == -1) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    for (size_t j = 0; j < fds.size(); ) {
+      if (fds[j].revents == 0) {j++; continue;}
+      int status = 0;
+      while (waitpid(_pids[stages[j]], &status, 0) == -1 && errno == EINTR);
+      _statuses[stages[j]] = exitStatus(status);
+      close(fds[j].fd);
+      fds.erase(fds.begin() + j);
+      stages.erase(stages.begin() + j);
+    }
+  }
+
+  // If poll failed for any other reason, wait for the remaining stages
+  // one at a time.
+  for (size_t j = 0; j < fds.size(); j++) {
+    int status = 0;
+    while (waitpid(_pids[stages[j]], &status, 0) == -1 && errno == EINTR);
+    _statuses[stages[j]] = exitStatus(status);
+    close(fds[j].fd);
+  }
+}
+
+// Reap whichever stages have exited without blocking. Returns true once
+// every stage of the pipeline has been reaped.
+bool Pipeline::reap() {
+  bool done = true;
+  for (size_t i = 0; i < _pids.size(); i++) {
+    if (_pids[i] <= 0 || _statuses[i] != -1) continue;
+    int status;
+    if (waitpid(_pids[i], &status, WNOHANG) == _pids[i]) {
+      _statuses[i] = exitStatus(status);
+    } else {
+      done = false;
+    }
+  }
+  return done;
+}
+
+// Return the process ID of the last stage that ran as a child, or -1.
+pid_t Pipeline::lastPid() {
+  for (size_t i = _pids.size(); i > 0; i--) {
+    if (_pids[i - 1] > 0) return _pids[i - 1];
+  }
+  return -1;
+}
+
+// Return the exit status of the last stage (the status of the pipeline).
+int Pipeline::lastStatus() {
+  if (_statuses.empty()) return 0;
+  return _statuses.back();
+}
@@ -0,0 +1,28 @@
+#ifndef pipeline_hh
+#define pipeline_hh
+
+#include <sys/types.h>
+#include <vector>
+
+// Pipeline Data Structure: records every stage launched for a command so
+// that all of them can be reaped and their exit statuses reported.
+
+struct Pipeline {
+  // Process ID of each stage (0 for stages that ran inside the shell)
+  // and its exit status (-1 until the stage has been reaped).
+  std::vector<pid_t> _pids;
+  std::vector<int> _statuses;
+
+  Pipeline( size_t stages );
+  void setProcess( size_t stage, pid_t pid );
+  void setStatus( size_t stage, int status );
+
+  void wait();
+  bool reap();
+  pid_t lastPid();
+  int lastStatus();
+
+  static int exitStatus( int status );
+};
+
+#endif
@@ -10,21 +10,272 @@
 #include <string.h>
 #include <unistd.h>
 
-#define MAX_BUFFER_LINE 2048
+// Bytes read from the terminal at a time.
+#define INPUT_BUFFER_SIZE 4096
 
 // Externs for external function to set and reset
 // terminal mode in shell.
 extern void tty_raw_mode(void);
 extern void tty_term_mode(void);
 
-// Buffer where line is stored
-int line_length;
-char line_buffer[MAX_BUFFER_LINE];
+// Buffer where line is stored, as a gap buffer: the text before the
+// cursor is at the start of line_buffer and the text after it at the end,
+// with the gap in between. Typing and deleting at the cursor only move an
+// edge of the gap, and moving the cursor carries the characters it passes
+// across the gap. The buffer doubles in size when the gap fills up, so a
+// line has no length limit.
+static char * line_buffer;
+static int line_capacity;
+static int gap_start;
+static int gap_end;
 
-// Command history array and initial values.
+// Command history array and initial values. The array doubles in size
+// when it fills up, so the history has no length limit.
 int history_index = 0;
-char * history[2048];
+char ** history;
 int history_length = 0;
+static int history_capacity = 0;
+
+// Terminal output of the key being handled. Echoed text and cursor
+// movements are collected here and written with a single write once the
+// key has been handled, instead of one write per character.
+static char * output_buffer;
+static int output_length;
+static int output_capacity;
+
+// Append length bytes of text to the output buffer.
+static void output_write(const char * text, int length)
+{
+  if (length == 0) return;
+  if (output_length + length > output_capacity) {
+    output_capacity = output_capacity ? output_capacity * 2 : 256;
+    while (output_capacity < output_length + length) output_capacity *= 2;
+    output_buffer = (char *)realloc(output_buffer, output_capacity);
+  }
+  memcpy(output_buffer + output_length, text, length);
+  output_length += length;
+}
+
+static void output_string(const char * text)
+{
+  output_write(text, strlen(text));
+}
+
+// Move the cursor count columns left (count < 0 moves it right) with one
+// ANSI sequence.
+static void output_cursor(int count)
+{
+  if (count == 0) return;
+  char sequence[32];
+  snprintf(sequence, sizeof(sequence), "\033[%d%c", count > 0 ? count : -count,
+           count > 0 ? 'D' : 'C');
+  output_string(sequence);
+}
+
+// Write the output buffer to the terminal.
+static void output_flush()
+{
+  int written = 0;
+  while (written < output_length) {
+    int n = write(1, output_buffer + written, output_length - written);
+    if (n <= 0) break;
+    written += n;
+  }
+  output_length = 0;
+}
+
+// Number of characters after the cursor.
+static int line_after()
+{
+  return line_capacity - gap_end;
+}
+
+// Make room for length more characters in the gap.
+static void line_reserve(int length)
+{
+  if (gap_end - gap_start >= length) return;
+  int after = line_after();
+  int capacity = line_capacity ? line_capacity * 2 : 256;
+  while (capacity - gap_start - after < length) capacity *= 2;
+  line_buffer = (char *)realloc(line_buffer, capacity);
+  memmove(line_buffer + capacity - after, line_buffer + gap_end, after);
+  gap_end = capacity - after;
+  line_capacity = capacity;
+}
+
+// Move the cursor, and with it the gap, to location.
+static void line_move(int location)
+{
+  if (location < gap_start) {
+    int count = gap_start - location;
+    memmove(line_buffer + gap_end - count, line_buffer + location, count);
+    gap_start -= count;
+    gap_end -= count;
+  } else if (location > gap_start) {
+    int count = location - gap_start;
+    memmove(line_buffer + gap_start, line_buffer + gap_end, count);
+    gap_start += count;
+    gap_end += count;
+  }
+}
+
+// Redraw the line from the cursor to its end, erasing what is left of it
+// on the screen after a deletion.
+static void output_after()
+{
+  output_write(line_buffer + gap_end, line_after());
+  output_string("\033[K");
+  output_cursor(line_after());
+}
+
+// Input read from the terminal and not handled yet. Whatever is available
+// (a whole paste, say) is read at once and then handed out key by key.
+static char input_buffer[INPUT_BUFFER_SIZE];
+static int input_start;
+static int input_end;
+
+// Set between the start and end markers of a bracketed paste.
+static int pasting;
+
+// Keys read_key() returns besides plain characters.
+enum {
+  KEY_EOF = -1,
+  KEY_UP = 256, KEY_DOWN, KEY_RIGHT, KEY_LEFT, KEY_HOME, KEY_END, KEY_DELETE,
+  KEY_PASTE_START, KEY_PASTE_END, KEY_UNKNOWN
+};
+
+// Return the next input byte, or -1 at the end of the input.
+static int input_byte()
+{
+  if (input_start == input_end) {
+    int n = read(0, input_buffer, sizeof(input_buffer));
+    if (n <= 0) return -1;
+    input_start = 0;
+    input_end = n;
+  }
+  return (unsigned char)input_buffer[input_start++];
+}
+
+// Key of the final character of a CSI or SS3 sequence.
+static int final_key(int ch)
+{
+  switch (ch) {
+  case 'A': return KEY_UP;
+  case 'B': return KEY_DOWN;
+  case 'C': return KEY_RIGHT;
+  case 'D': return KEY_LEFT;
+  case 'H': return KEY_HOME;
+  case 'F': return KEY_END;
+  default: return KEY_UNKNOWN;
+  }
+}
+
+// Key of a CSI sequence ending in ~, by its first parameter.
+static int tilde_key(int parameter)
+{
+  switch (parameter) {
+  case 1: case 7: return KEY_HOME;
+  case 4: case 8: return KEY_END;
+  case 3: return KEY_DELETE;
+  case 200: return KEY_PASTE_START;
+  case 201: return KEY_PASTE_END;
+  default: return KEY_UNKNOWN;
+  }
+}
+
+// Read one key: a character, or a whole escape sequence. CSI sequences
+// (ESC [ parameters intermediates final) and SS3 sequences (ESC O final)
+// are read to their end, so unknown ones are skipped as a whole instead
+// of leaving their last bytes to be taken as typed text. Modifiers are
+// ignored: ESC [ 1 ; 5 D is a left arrow.
+static int read_key()
+{
+  enum { GROUND, ESCAPE, CSI, SS3 } state = GROUND;
+  int parameter = 0;
+  int first_parameter = 1;
+
+  while (1) {
+    int ch = input_byte();
+    if (ch < 0) return KEY_EOF;
+    switch (state) {
+    case GROUND:
+      if (ch != 27) return ch;
+      state = ESCAPE;
+      break;
+    case ESCAPE:
+      if (ch == '[') state = CSI;
+      else if (ch == 'O') state = SS3;
+      else return KEY_UNKNOWN;
+      break;
+    case CSI:
+      if (ch >= '0' && ch <= '9') {
+        if (first_parameter && parameter < 1000) parameter = parameter * 10 + ch - '0';
+      } else if (ch == ';') {
+        first_parameter = 0;
+      } else if (ch == '~') {
+        return tilde_key(parameter);
+      } else if (ch >= 0x40 && ch <= 0x7e) {
+        return final_key(ch);
+      } else if (ch < 0x20 || ch > 0x3f) {
+        // Not a parameter or intermediate byte: a broken sequence.
+        return KEY_UNKNOWN;
+      }
+      break;
+    case SS3:
+      return final_key(ch);
+    }
+  }
+}
+
+// Length of the run of printable characters at the front of the input
+// buffer.
+static int input_text()
+{
+  int n = 0;
+  while (input_start + n < input_end &&
+         input_buffer[input_start + n] >= 32 && input_buffer[input_start + n] != 127) {
+    n++;
+  }
+  return n;
+}
+
+// Insert length characters of text at the cursor, echoing them and the
+// rest of the line.
+static void insert_text(const char * text, int length)
+{
+  line_reserve(length);
+  memcpy(line_buffer + gap_start, text, length);
+  gap_start += length;
+  output_write(line_buffer + gap_start - length, length);
+  output_write(line_buffer + gap_end, line_after());
+  // Move the cursor back to just after the inserted text.
+  output_cursor(line_after());
+}
+
+// Replace the line, on the screen too, with text, leaving the cursor at
+// its end.
+static void replace_line(const char * text)
+{
+  output_cursor(gap_start);
+  output_string("\033[K");
+  gap_start = 0;
+  gap_end = line_capacity;
+  insert_text(text, strlen(text));
+}
+
+// Add the line (without its newline) to the end of the history.
+static void history_add()
+{
+  if (history_length == history_capacity) {
+    history_capacity = history_capacity ? history_capacity * 2 : 64;
+    history = (char **)realloc(history, history_capacity * sizeof(char *));
+  }
+  history[history_length] = (char *)malloc(gap_start + 1);
+  memcpy(history[history_length], line_buffer, gap_start);
+  history[history_length][gap_start] = '\0';
+  history_length++;
+  history_index = history_length - 1;
+}
 
 // Print default usage (not required to be updated in handout)
 void read_line_print_usage()
@@ -34,259 +285,135 @@ void read_line_print_usage()
     " Backspace    Deletes last character\n"
     " up arrow     See last command in the history\n";
 
-  write(1, usage, strlen(usage));
+  output_string(usage);
 }
 
 /* 
- * Input a line with some basic editing.
+ * Input a line with some basic editing. Returns NULL once the input has
+ * ended and there is no line left to return.
  */
 char * read_line() {
 
-  // Set terminal in raw mode
+  // Set terminal in raw mode, with pasted text marked by the terminal
+  output_flush();
   tty_raw_mode();
+  output_string("\033[?2004h");
 
-  line_length = 0;
-  int location = line_length;
+  gap_start = 0;
+  gap_end = line_capacity;
+  int eof = 0;
 
   // Read one line until enter is typed
   while (1) {
 
-    // Read one character in raw mode.
-    char ch;
-    read(0, &ch, 1);
-    
+    // Send the output of the previous key to the terminal, then read the
+    // next one.
+    output_flush();
+    int key = read_key();
+    if (key == KEY_EOF) {
+      eof = 1;
+      break;
+    }
+
+    if (key == KEY_PASTE_START || key == KEY_PASTE_END) {
+      pasting = key == KEY_PASTE_START;
+      continue;
+    }
+    // Pasted text is inserted as it is: tabs become spaces, and other
+    // control characters and escape sequences do not edit the line. A
+    // newline still ends it, and the rest of the paste is the next line.
+    if (pasting && key == 9) key = ' ';
+    if (pasting && key != 10 && (key < 32 || key >= 127)) continue;
+
     // Printable character and not a backspace
-    if (ch >= 32 && ch != 127) {
-      // If cursor is at the end of the line, simple insertion can be done 
-      if (location == line_length) {	
-        // Do echo
-        write(1, &ch, 1);
-	line_buffer[line_length] = ch;
-      // Otherwise, tranfer buffer to temporary memory, write new character,
-      // and transfer the original line_buffer back.
-      } else {
-        char temp_buffer[line_length - location + 1];
-	for (int i = 0; i < line_length - location; i++) {
-	  temp_buffer[i] = line_buffer[location + i];
-	}
-	write(1, &ch, 1);
-	line_buffer[location] = ch;
-	for (int i = 0; i < line_length - location; i++) {
-	  line_buffer[location + i + 1] = temp_buffer[i];
-	  write(1, &temp_buffer[i], 1);
-	}
-	// Correct for adding another character by moving cursor back
-	// to original position.
-	for (int i = 0; i < line_length - location; i++) {
-	  ch = 8;
-	  write(1, &ch, 1);
-	}
-      }
-      // If max number of character reached return.
-      if (line_length == MAX_BUFFER_LINE - 2) break; 
-      // Update cursor location and total line length.
-      location++;
-      line_length++;
-    } else if ( ch == 10) {
+    if (key >= 32 && key < 127) {
+      // Insert it along with the printable characters read after it (a
+      // paste, or keys typed ahead). The key is the byte just taken from
+      // the input buffer (a pasted tab is put back there as the space it
+      // was turned into).
+      int length = 1 + input_text();
+      input_buffer[input_start - 1] = key;
+      insert_text(input_buffer + input_start - 1, length);
+      input_start += length - 1;
+    } else if (key == 10) {
       // <Enter> was typed. Return line
       
       // Print newline
-      write(1, &ch, 1); 
+      output_string("\n");
       break;
-    } else if (ch == 31) {
+    } else if (key == 31) {
       // ctrl-?
       read_line_print_usage();
-      line_buffer[0] = 0;
+      gap_start = 0;
+      gap_end = line_capacity;
       break;
-    } else if ((ch == 8 || ch == 127) && location > 0) {
-      // <backspace> or CTRL-H was typed. Remove previous character read.
-      ch = 8;
-      write(1, &ch, 1);
-      // If cursor is at the end of the line, simple deletion can be done.
-      if (location == line_length) {
-        // Write a space to erase the last character read
-        ch = ' ';
-        write(1,&ch,1);
-
-        // Go back one character
-        ch = 8;
-        write(1,&ch,1);
-      // Otherwise, overwrite the entire buffer back by one character,
-      // updating the null terminator and shifting the cursor back to the 
-      // correct position.
-      } else {
-        for (int i = 0; i < line_length - location; i++) {
-	  write(1, &line_buffer[i + location], 1);
-	  line_buffer[i + location - 1] = line_buffer[i + location];
-	}
-	ch = ' ';
-	write(1, &ch, 1);
-	line_buffer[line_length - 1] = '\0';
-	for (int i = 0; i < line_length - location + 1; i++) {
-	  ch = 8;
-	  write(1, &ch, 1);
-	}
-      }
-      // Update final location and remove one from total line length.
-      line_length--;
-      location--;
-    } else if ((ch == 4) && location < line_length) {
+    } else if ((key == 8 || key == 127) && gap_start > 0) {
+      // <backspace> or CTRL-H was typed. Remove previous character read
+      // and redraw the rest of the line one column to the left.
+      gap_start--;
+      output_cursor(1);
+      output_after();
+    } else if ((key == 4 || key == KEY_DELETE) && line_after() > 0) {
       // CTRL-D - Delete Key
       // If at the end of the line, there is nothing to delete.
-      // Otherwise, overwrite the rest of the buffer back by one character,
-      // updating the null terminator and shifting the cursor back to the 
-      // correct position.
-      for (int i = 0; i < line_length - location; i++) {
-        write(1, &line_buffer[i + location + 1], 1);
-	line_buffer[i + location] = line_buffer[i + location + 1];
-      }
-      ch = ' ';
-      write(1, &ch, 1);
-      line_buffer[line_length] = '\0';
-      for (int i = 0; i < line_length - location; i++) {
-        ch = 8;
-	write(1, &ch, 1);
-      }
-      // Remove one from total line length.
-      line_length--;      
-    } else if (ch == 1) {
+      // Otherwise, remove the character after the cursor and redraw the
+      // rest of the line.
+      gap_end++;
+      output_after();
+    } else if (key == 1 || key == KEY_HOME) {
       // Home/CTRL-A
-      while (location > 0) {
-        ch = 8;
-	write(1,&ch,1);
-	location--;
-      } 
-    } else if (ch == 5) {
+      output_cursor(gap_start);
+      line_move(0);
+    } else if (key == 5 || key == KEY_END) {
       // End/CTRL-E
-      while (location < line_length) {
-	ch = line_buffer[location];
-	write(1,&ch,1);
-        location++;
+      output_cursor(-line_after());
+      line_move(gap_start + line_after());
+    } else if (key == KEY_UP && history_length > 0) {
+      // Up arrow. Print next line in history.
+      replace_line(history[history_index][0] == '\n' ? "" : history[history_index]);
+
+      history_index--;
+      if (history_index < 0) history_index = history_length - 1;
+    } else if (key == KEY_DOWN && history_length > 0) {
+      // Down arrow. Print previous line in history.
+      history_index++;
+      if (history_index > history_length - 1) history_index = 0;
+
+      replace_line(history[history_index][0] == '\n' ? "" : history[history_index]);
+    } else if (key == KEY_LEFT) {
+      // Left arrow
+      if (gap_start > 0) {
+        output_cursor(1);
+        line_move(gap_start - 1);
       }
-    } else if (ch == 27) {
-      // Escape sequence. Read two chars more
-      //
-      // HINT: Use the program "keyboard-example" to
-      // see the ascii code for the different chars typed.
-      //
-      char ch1; 
-      char ch2;
-      read(0, &ch1, 1);
-      read(0, &ch2, 1);
-      if (ch1 == 91 && ch2 == 65 && history_length > 0) {
-	// Up arrow. Print next line in history.
-  
-	// Erase old line
-	// Print backspaces
-	int i = 0;
-	for (i = 0; i < location; i++) {
-	  ch = 8;
-	  write(1,&ch,1);
-	}
-
-	// Print spaces on top
-	for (i = 0; i < line_length; i++) {
-	  ch = ' ';
-	  write(1,&ch,1);
-	}
-
-	// Print backspaces
-	for (int i = 0; i < line_length; i++) {
-	  ch = 8;
-	  write(1,&ch,1);
-	}		
-
-	// Copy line from history
-	if (history[history_index][0] == '\n') {
-	  strcpy(line_buffer, "");
-	} else {
-	  strcpy(line_buffer, history[history_index]);
-	}
-
-        history_index--;
-	if (history_index < 0) history_index = history_length - 1;
-
-	line_length = strlen(line_buffer);
-
-	for (int i = 0; i < line_length; i++) {
-	  ch = line_buffer[i];
-          write(1, &ch, 1);
-	}
-
-	// Set cursor to the end of the line.
-	location = line_length;
-      } else if (ch1 == 91 && ch2 == 66 && history_length > 0) {
-        // Down arrow. Print previous line in history.
-        int i = 0;
-	for (i = 0; i < location; i++) {
-	  ch = 8;
-	  write(1,&ch,1);
-	}
-
-	// Print spaces on top
-	for (i = 0; i < line_length; i++) {
-	  ch = ' ';
-	  write(1,&ch,1);
-	}
-
-	// Print backspaces
-	for (i = 0; i < line_length; i++) {
-	  ch = 8;
-	  write(1,&ch,1);
-	}
-        
-	// Copy line from history
-	history_index++;
-        if (history_index > history_length - 1) history_index = 0;
-
-        if (history[history_index][0] == '\n') {
-	  strcpy(line_buffer, "");
-	} else {
-	  strcpy(line_buffer, history[history_index]);
-	}
-
-	line_length = strlen(line_buffer);
-	       
-        for (int i = 0; i < line_length; i++) {
-	  ch = line_buffer[i];
-	  write(1, &ch, 1);
-	}
-
-	// Update cursor to the end of the line.
-	location = line_length;
-      } else if (ch1 == 91 && ch2 == 68) {
-        // Left arrow
-	if (location > 0) {
-	  ch = 8;
-	  write(1,&ch,1);
-	  location--;
-	}
-      } else if (ch1 == 91 && ch2 == 67) {
-        // Right arrow
-	if (location < line_length) {
-	  ch = line_buffer[location];
-	  write(1,&ch,1);
-	  location++;
-	}
+    } else if (key == KEY_RIGHT) {
+      // Right arrow
+      if (line_after() > 0) {
+        output_cursor(-1);
+        line_move(gap_start + 1);
       }
     }
 
   }
+  output_string("\033[?2004l");
+  output_flush();
+
+  // The input ended before anything was typed: there is no line.
+  if (eof && gap_start == 0 && line_after() == 0) {
+    tty_term_mode();
+    return NULL;
+  }
   
-  // Add eol and null char at the end of string
-  line_buffer[line_length] = 10;
-  line_length++;
-  line_buffer[line_length] = 0;
+  // Close the gap at the end of the line and add eol and null char at the
+  // end of string
+  line_move(gap_start + line_after());
+  line_reserve(2);
+  line_buffer[gap_start] = 10;
+  line_buffer[gap_start + 1] = 0;
   
-  // If the buffer is not empty, add an entry to the history table and adjust the null terminator amd
-  // history length and index.
-  if (strlen(line_buffer) != 0) {
-    history[history_length] = (char *)malloc(strlen(line_buffer) * sizeof(char) + 1);
-    strcpy(history[history_length], line_buffer);
-    history[history_length][line_length - 1] = '\0';
-    history_length++;
-    history_index = history_length - 1;
-  }
+  // Add an entry to the history table, unless the line is empty (as the
+  // one ctrl-? leaves is).
+  if (gap_start > 0) history_add();
 
   // Call external function to reset terminal mode.
   tty_term_mode();
@@ -0,0 +1,231 @@
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "scriptCache.hh"
+#include "environment.hh"
+
+// First bytes of every cache file, changed whenever the format changes.
+#define SCRIPT_CACHE_MAGIC "SHTOKENS5"
+
+// Directory the cached scripts are written to: $XDG_CACHE_HOME/shell or
+// ~/.cache/shell. Returns an empty string if neither is set.
+static std::string cacheDirectory() {
+  std::string base;
+  if (Environment::get("XDG_CACHE_HOME", base) && !base.empty()) return base + "/shell";
+  std::string home;
+  if (Environment::get("HOME", home) && !home.empty()) return home + "/.cache/shell";
+  return "";
+}
+
+// Path of the cache file for the script at path.
+static std::string cacheFile( const std::string & path ) {
+  char name[32];
+  snprintf(name, sizeof(name), "/%016zx.tokens", std::hash<std::string>()(path));
+  return cacheDirectory() + name;
+}
+
+// Return true if script was cached from the file described by st.
+static bool matches( const ScriptCache::Script & script, const struct stat & st ) {
+  return script._dev == st.st_dev && script._ino == st.st_ino &&
+         script._size == st.st_size &&
+         script._mtime.tv_sec == st.st_mtim.tv_sec &&
+         script._mtime.tv_nsec == st.st_mtim.tv_nsec;
+}
+
+static bool readValue( FILE * fp, void * value, size_t size ) {
+  return fread(value, size, 1, fp) == 1;
+}
+
+static bool readString( FILE * fp, std::string & text, size_t limit ) {
+  uint32_t length;
+  if (!readValue(fp, &length, sizeof(length)) || length > limit) return false;
+  text.resize(length);
+  return length == 0 || fread(&text[0], length, 1, fp) == 1;
+}
+
+static void writeString( FILE * fp, const std::string & text ) {
+  uint32_t length = text.size();
+  fwrite(&length, sizeof(length), 1, fp);
+  fwrite(text.data(), length, 1, fp);
+}
+
+// Read the cache file of the script at path. Returns NULL if there is none
+// or it was written for another version of the file.
+static std::shared_ptr<const ScriptCache::Script> loadScript( const std::string & path,
+                                                              const struct stat & st ) {
+  FILE * fp = fopen(cacheFile(path).c_str(), "rb");
+  if (fp == NULL) return NULL;
+
+  auto script = std::make_shared<ScriptCache::Script>();
+  char magic[sizeof(SCRIPT_CACHE_MAGIC)];
+  std::string cached_path;
+  int64_t dev, ino, size, sec, nsec;
+  uint32_t count;
+  bool ok = readValue(fp, magic, sizeof(magic)) &&
+            memcmp(magic, SCRIPT_CACHE_MAGIC, sizeof(magic)) == 0 &&
+            readString(fp, cached_path, PATH_MAX) && cached_path == path &&
+            readValue(fp, &dev, sizeof(dev)) && readValue(fp, &ino, sizeof(ino)) &&
+            readValue(fp, &size, sizeof(size)) && readValue(fp, &sec, sizeof(sec)) &&
+            readValue(fp, &nsec, sizeof(nsec)) && readValue(fp, &count, sizeof(count));
+  if (ok) {
+    script->_dev = dev;
+    script->_ino = ino;
+    script->_size = size;
+    script->_mtime.tv_sec = sec;
+    script->_mtime.tv_nsec = nsec;
+    ok = matches(*script, st) && count <= (uint64_t) st.st_size + 1;
+  }
+  for (uint32_t i = 0; ok && i < count; i++) {
+    int32_t type;
+    uint8_t kind;
+    ScriptCache::Token token;
+    ok = readValue(fp, &type, sizeof(type)) && readValue(fp, &kind, sizeof(kind)) &&
+         kind <= Word::SUBSTITUTION && readString(fp, token._word._text, st.st_size);
+    token._type = type;
+    token._word._kind = (Word::Kind) kind;
+    script->_tokens.push_back(std::move(token));
+  }
+  fclose(fp);
+  if (!ok) return NULL;
+  return script;
+}
+
+// Write the cache file of the script at path. The file is written under a
+// temporary name and renamed, so readers never see a partial file.
+static void saveScript( const std::string & path, const ScriptCache::Script & script ) {
+  std::string dir = cacheDirectory();
+  if (dir.empty()) return;
+  for (size_t slash = dir.find('/', 1); ; slash = dir.find('/', slash + 1)) {
+    mkdir(dir.substr(0, slash).c_str(), 0700);
+    if (slash == std::string::npos) break;
+  }
+
+  std::string file = cacheFile(path);
+  std::string temp = file + "." + std::to_string(getpid());
+  FILE * fp = fopen(temp.c_str(), "wb");
+  if (fp == NULL) return;
+  int64_t key[5] = {(int64_t) script._dev, (int64_t) script._ino, (int64_t) script._size,
+                    (int64_t) script._mtime.tv_sec, (int64_t) script._mtime.tv_nsec};
+  uint32_t count = script._tokens.size();
+  fwrite(SCRIPT_CACHE_MAGIC, sizeof(SCRIPT_CACHE_MAGIC), 1, fp);
+  writeString(fp, path);
+  fwrite(key, sizeof(key), 1, fp);
+  fwrite(&count, sizeof(count), 1, fp);
+  for (auto & token : script._tokens) {
+    int32_t type = token._type;
+    uint8_t kind = token._word._kind;
+    fwrite(&type, sizeof(type), 1, fp);
+    fwrite(&kind, sizeof(kind), 1, fp);
+    writeString(fp, token._word._text);
+  }
+  if (fclose(fp) != 0 || rename(temp.c_str(), file.c_str()) != 0) unlink(temp.c_str());
+}
+
+// Start a source call of file. If its tokens are cached (in memory or on
+// disk) for the file as it is now, a replaying frame is pushed and true is
+// returned. Otherwise a recording frame is pushed and false is returned;
+// the file must then be scanned. Setting SOURCE_CACHE to 0 disables the
+// cache. Files modified less than a second ago are not recorded, since a
+// change within the same timestamp tick would not be noticed.
+bool ScriptCache::begin( const char * file ) {
+  Frame frame;
+  frame._replay = false;
+  frame._position = 0;
+  frame._valid = false;
+
+  std::string setting;
+  bool enabled = !Environment::get("SOURCE_CACHE", setting) || setting != "0";
+  char resolved[PATH_MAX];
+  struct stat st;
+  if (enabled && realpath(file, resolved) &&
+      stat(resolved, &st) == 0 && S_ISREG(st.st_mode)) {
+    frame._path = resolved;
+    auto cached = _cache.find(frame._path);
+    if (cached != _cache.end() && matches(*cached->second, st)) {
+      frame._script = cached->second;
+    } else if ((frame._script = loadScript(frame._path, st)) != NULL) {
+      _cache[frame._path] = frame._script;
+    }
+
+    if (frame._script) {
+      _hits++;
+      frame._replay = true;
+    } else {
+      _misses++;
+      struct timespec now;
+      clock_gettime(CLOCK_REALTIME, &now);
+      frame._recording = std::make_shared<Script>();
+      frame._recording->_dev = st.st_dev;
+      frame._recording->_ino = st.st_ino;
+      frame._recording->_size = st.st_size;
+      frame._recording->_mtime = st.st_mtim;
+      frame._valid = now.tv_sec - st.st_mtim.tv_sec > 1;
+    }
+  }
+
+  _frames.push_back(frame);
+  return frame._replay;
+}
+
+// Finish the innermost source call. A recording that reached the end of
+// the file is cached.
+void ScriptCache::end() {
+  if (_frames.empty()) return;
+  Frame & frame = _frames.back();
+  if (!frame._replay && frame._valid && !frame._recording->_tokens.empty() &&
+      frame._recording->_tokens.back()._type == 0) {
+    _cache[frame._path] = frame._recording;
+    saveScript(frame._path, *frame._recording);
+  }
+  _frames.pop_back();
+}
+
+// Return the innermost source call in progress, or NULL.
+ScriptCache::Frame * ScriptCache::top() {
+  if (_frames.empty()) return NULL;
+  return &_frames.back();
+}
+
+// Add a token scanned from the file of the innermost source call, with
+// its word if it is a WORD or FNAME token.
+void ScriptCache::record( int type, const Word * word ) {
+  Frame * frame = top();
+  if (frame == NULL || frame->_replay || !frame->_valid) return;
+  Token token;
+  token._type = type;
+  token._word = word ? *word : Word{Word::UNQUOTED, ""};
+  frame->_recording->_tokens.push_back(std::move(token));
+}
+
+// Drop every source call in progress (in a forked subshell, which starts a
+// parse of its own).
+void ScriptCache::reset() {
+  _frames.clear();
+}
+
+// Print the number of cached scripts and the hit counters.
+void ScriptCache::print() {
+  long total = _hits + _misses;
+  printf("%zu scripts cached, %ld hits, %ld misses (%.1f%% hit rate)\n",
+         _cache.size(), _hits, _misses, total ? 100.0 * _hits / total : 0.0);
+}
+
+// Forget every cached script, including the cache files written for
+// them, and reset the counters.
+void ScriptCache::clear() {
+  for (auto & cached : _cache) unlink(cacheFile(cached.first).c_str());
+  _cache.clear();
+  _hits = 0;
+  _misses = 0;
+}
+
+std::unordered_map<std::string, std::shared_ptr<const ScriptCache::Script>> ScriptCache::_cache;
+std::vector<ScriptCache::Frame> ScriptCache::_frames;
+long ScriptCache::_hits;
+long ScriptCache::_misses;
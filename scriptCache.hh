@@ -0,0 +1,62 @@
+#ifndef scriptcache_hh
+#define scriptcache_hh
+
+#include <ctime>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <sys/types.h>
+
+#include "ast.hh"
+
+// Script Cache Data Structure: remembers the tokens flex produced for each
+// sourced file, in memory and in a binary file under the cache directory,
+// so sourcing an unchanged file again replays its tokens to the parser
+// without scanning it. Words are unexpanded in the tokens, so replaying
+// them is the same as scanning the file again.
+
+struct ScriptCache {
+
+  // A token and, for WORD tokens, the word.
+  struct Token {
+    int _type;
+    Word _word;
+  };
+
+  // Tokens of a file, valid while the file is the same inode with the
+  // same size and modification time.
+  struct Script {
+    dev_t _dev;
+    ino_t _ino;
+    off_t _size;
+    struct timespec _mtime;
+    std::vector<Token> _tokens;
+  };
+
+  // A source call in progress: either replaying a cached script, or
+  // recording the tokens scanned from the file.
+  struct Frame {
+    std::string _path;
+    bool _replay;
+    std::shared_ptr<const Script> _script;
+    size_t _position;
+    std::shared_ptr<Script> _recording;
+    bool _valid;
+  };
+
+  static bool begin( const char * file );
+  static void end();
+  static Frame * top();
+  static void record( int type, const Word * word );
+  static void reset();
+  static void print();
+  static void clear();
+
+  static std::unordered_map<std::string, std::shared_ptr<const Script>> _cache;
+  static std::vector<Frame> _frames;
+  static long _hits;
+  static long _misses;
+};
+
+#endif
@@ -1,38 +1,43 @@
+#include <cerrno>
 #include <cstdio>
+#include <cstring>
 
 #include "shell.hh"
+#include "environment.hh"
+#include "executor.hh"
 #include "y.tab.hh"
 #include <unistd.h>
 #include <signal.h>
 #include <sys/wait.h>
 
 // Prototypes for imported commands
-int yyparse(void);
 int source_cmd(const char * filename);
+int script_cmd(const char * filename);
+int string_cmd(const char * text);
 void yyrestart(FILE *);
 
 extern "C" void sigINT (int sig) {
     
-    // Handle CTRL-C, and print a prompt if command not already present
-    // (if a command was running, it will handle printing the new prompt
+    // Handle CTRL-C, and print a prompt if no command is running
+    // (if a command was running, the executor prints the new prompt
     // when execution is stopped)	
     if (sig == SIGINT) {
+	Shell::_interrupted = 1;
     	printf("\n");
-	if (Shell::_currentCommand._simpleCommands.size() == 0) {
+	if (Executor::_running == 0) {
 	  Shell::prompt();
 	}
-	// Clear/deallocate running command.
-        Shell::_currentCommand.clear();
     }
-    // Handle Zombie Processes, and print the PID of the process
-    // that was stopped, checking the PID against the background
-    // process tracking data structure.
+    // Handle Zombie Processes of background pipelines only (foreground
+    // pipelines are collected by Pipeline::wait()). Once every stage of a
+    // background pipeline is reaped, print the PID of its last process,
+    // checking it against the background process tracking data structure.
     if (sig == SIGCHLD) {
-	pid_t pid = waitpid(-1, NULL, WNOHANG);
-	Shell::process_check(pid);
-	while (pid > 0) {
-	    pid = waitpid(-1, NULL, WNOHANG);
-	    Shell::process_check(pid);
+	for (unsigned int i = 0; i < Shell::_bkgPipelines.size(); ) {
+	    if (Shell::_bkgPipelines[i].reap()) {
+	        Shell::process_check(Shell::_bkgPipelines[i].lastPid());
+	        Shell::_bkgPipelines.erase(Shell::_bkgPipelines.begin() + i);
+	    } else {i++;}
 	}
     }
 }
@@ -55,15 +60,15 @@ void Shell::prompt() {
   // Print a prompt to the user if the command did not originate
   // from a source call, and input did not come from a file.
   if (isatty(0) && !_source) {
-    char * custom_prompt = getenv("PROMPT");
-    if (custom_prompt) printf("%s", custom_prompt);
+    std::string custom_prompt;
+    if (Environment::get("PROMPT", custom_prompt)) printf("%s", custom_prompt.c_str());
     else printf("myshell>");
   }
   // Flush stdout buffer.
   fflush(stdout);
 }
 
-int main() {
+int main(int argc, char ** argv) {
   // Initialize and set up necessary items and flags
   // for sigaction to catch signals.
   struct sigaction sa;
@@ -77,9 +82,9 @@ int main() {
   Shell::_returnStatus = -1;
   Shell::_lastBkgProcess = -1;
 
-  // When shell process starts, run source command
+  // When an interactive shell process starts, run source command
   // with set-up file .shellrc
-  source_cmd(".shellrc");
+  if (argc < 2) source_cmd(".shellrc");
 
   // Catch SIGINT (CTRL-C) signals and handle errors.
   if (sigaction(SIGINT, &sa, NULL)) {
@@ -93,15 +98,39 @@ int main() {
 	exit(2);
   }
 
+  // With -c, or a script file, compile the commands given and run them,
+  // then exit with the status of the last one. The words after the
+  // commands (-c) or the script file are the positional parameters,
+  // starting from ${0}.
+  Shell::_arguments.push_back(argv[0]);
+  if (argc > 1) {
+    int status;
+    if (strcmp(argv[1], "-c") == 0 && argc > 2) {
+      if (argc > 3) Shell::_arguments.assign(argv + 3, argv + argc);
+      status = string_cmd(argv[2]);
+    } else {
+      Shell::_arguments.assign(argv + 1, argv + argc);
+      status = script_cmd(argv[1]);
+      if (status == -1) {
+        fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+        exit(127);
+      }
+    }
+    exit(status);
+  }
+
   // Print prompt to the user, restart stdin buffer,
-  // and call parser.
+  // and run the commands read from it.
   Shell::prompt();
   yyrestart(stdin);
-  yyparse();
+  Executor::runInput();
 }
 
-Command Shell::_currentCommand;
 std::vector<int> Shell::_bkgPIDs;
+std::vector<Pipeline> Shell::_bkgPipelines;
+std::vector<int> Shell::_pipeStatus;
 bool Shell::_source;
+std::vector<std::string> Shell::_arguments;
 int Shell::_returnStatus;
 int Shell::_lastBkgProcess;
+volatile sig_atomic_t Shell::_interrupted = 0;
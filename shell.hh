@@ -1,7 +1,10 @@
 #ifndef shell_hh
 #define shell_hh
 
+#include <csignal>
+
 #include "command.hh"
+#include "pipeline.hh"
 
 // Shell Data Structure
 
@@ -11,14 +14,24 @@ struct Shell {
   static int source(const char * filename);
   static void process_check(pid_t pid);
 
-  static Command _currentCommand;
   static std::vector<int> _bkgPIDs;
+  static std::vector<Pipeline> _bkgPipelines;
+  static std::vector<int> _pipeStatus;
   static bool _source;
   static std::string * _lastArgument;
+
+  // Positional parameters: ${0} and the arguments of the script or of the
+  // function being called.
+  static std::vector<std::string> _arguments;
  
   static int _returnStatus;
   static int _lastBkgProcess;
 
+  // Set by the SIGINT handler. Loops and command lists running inside the
+  // shell stop when they see it, and it is cleared before the next command
+  // line.
+  static volatile sig_atomic_t _interrupted;
+
 };
 
 #endif
@@ -25,6 +25,16 @@ void SimpleCommand::insertArgument( std::string * argument ) {
   _arguments.push_back(argument);
 }
 
+// Record that the arguments from first to the last one inserted came from
+// expanding a single word, so they may be split across several execs. The
+// ranges of the words it was expanded into (the wildcards in each word of
+// a brace expansion) are replaced by the one range.
+void SimpleCommand::markExpanded( size_t first ) {
+  if (first >= _arguments.size()) return;
+  while (!_expanded.empty() && _expanded.back().first >= first) _expanded.pop_back();
+  _expanded.emplace_back(first, _arguments.size() - 1);
+}
+
 // Print out the simple command
 void SimpleCommand::print() {
   for (auto & arg : _arguments) {
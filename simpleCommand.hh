@@ -1,7 +1,8 @@
-#ifndef simplcommand_hh
+#ifndef simplecommand_hh
 #define simplecommand_hh
 
 #include <string>
+#include <utility>
 #include <vector>
 
 struct SimpleCommand {
@@ -9,9 +10,14 @@ struct SimpleCommand {
   // Simple command is simply a vector of strings
   std::vector<std::string *> _arguments;
 
+  // Ranges of arguments (first and last index) produced by wildcard or
+  // brace expansion, in order
+  std::vector<std::pair<size_t, size_t>> _expanded;
+
   SimpleCommand();
   ~SimpleCommand();
   void insertArgument( std::string * argument );
+  void markExpanded( size_t first );
   void print();
 };
 
@@ -0,0 +1,42 @@
+#include <cerrno>
+#include <vector>
+
+#include <spawn.h>
+
+#include "spawn.hh"
+#include "environment.hh"
+
+// Launch the program at path (already resolved by the shell, so the child
+// execs it directly) with fdin/fdout/fderr installed as the child's
+// stdin/stdout/stderr. glibc implements posix_spawn with
+// clone(CLONE_VM|CLONE_VFORK), so no page tables are copied. A file that
+// is executable but not a binary or a #! script is run by /bin/sh, as
+// execvp does. Returns the child PID, or -1 with errno set if the program
+// could not be executed.
+pid_t Spawn::launch(const char * path, char * const argv[], int fdin, int fdout, int fderr) {
+  // Set up the descriptor table of the child: the dup2 calls the shell
+  // used to make in its own process now happen inside the child.
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, fdin, 0);
+  posix_spawn_file_actions_adddup2(&actions, fdout, 1);
+  posix_spawn_file_actions_adddup2(&actions, fderr, 2);
+
+  // Spawn the child and release the file actions. Every other descriptor
+  // the shell holds is close-on-exec, so the child only keeps 0, 1 and 2.
+  pid_t pid;
+  int error = posix_spawn(&pid, path, &actions, NULL, argv, Environment::environ());
+  if (error == ENOEXEC) {
+    std::vector<char *> sh_argv = {(char *) "/bin/sh", (char *) path};
+    for (int i = 1; argv[i] != NULL; i++) sh_argv.push_back(argv[i]);
+    sh_argv.push_back(NULL);
+    error = posix_spawn(&pid, "/bin/sh", &actions, NULL, sh_argv.data(), Environment::environ());
+  }
+  posix_spawn_file_actions_destroy(&actions);
+
+  if (error != 0) {
+    errno = error;
+    return -1;
+  }
+  return pid;
+}
@@ -0,0 +1,15 @@
+#ifndef spawn_hh
+#define spawn_hh
+
+#include <sys/types.h>
+
+// Spawn Data Structure: launches external commands with posix_spawn so
+// the shell never has to duplicate its own address space to run a program.
+
+struct Spawn {
+
+  static pid_t launch(const char * path, char * const argv[], int fdin, int fdout, int fderr);
+
+};
+
+#endif
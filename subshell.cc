@@ -0,0 +1,227 @@
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <climits>
+#include <functional>
+#include <string_view>
+
+#include <poll.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "subshell.hh"
+#include "spawn.hh"
+#include "environment.hh"
+
+// Size of each read from the subshell output pipe.
+#define SUBSHELL_CHUNK 65536
+
+// Most substitutions the cache keeps.
+#define SUBST_CACHE_SIZE 1024
+
+// Prototypes for imported functions
+int subshell_parse(const char * text);
+
+// Return the output of a command substitution. If SUBST_CACHE_TTL is set
+// to a positive number of seconds, outputs are remembered per command text,
+// working directory and environment, and a fresh enough entry is returned
+// without running a subshell at all. The cache is meant for pure commands:
+// shell variables that are not exported, functions and positional
+// parameters are not part of the key.
+std::string Subshell::substitute( const std::string & command ) {
+  std::string ttl_env;
+  double ttl = Environment::get("SUBST_CACHE_TTL", ttl_env) ? strtod(ttl_env.c_str(), NULL) : 0;
+  if (ttl <= 0) return run(command);
+
+  // Build the cache key from the command, the current directory and a
+  // hash of the exported environment, so any change to them is a miss.
+  char cwd[PATH_MAX];
+  if (!getcwd(cwd, sizeof(cwd))) cwd[0] = '\0';
+  size_t environment = 0;
+  for (char ** env = Environment::environ(); *env; env++) {
+    environment = environment * 31 + std::hash<std::string_view>()(*env);
+  }
+  std::string key = command + '\0' + cwd + '\0' + std::to_string(environment);
+
+  auto now = std::chrono::steady_clock::now();
+  auto entry = _cache.find(key);
+  if (entry != _cache.end() &&
+      std::chrono::duration<double>(now - entry->second._time).count() < ttl) {
+    entry->second._hits++;
+    return entry->second._output;
+  }
+
+  // Before adding an entry to a full cache, drop the expired entries, or
+  // every entry if none has expired.
+  std::string output = run(command);
+  if (_cache.size() >= SUBST_CACHE_SIZE) {
+    for (auto i = _cache.begin(); i != _cache.end(); ) {
+      if (std::chrono::duration<double>(now - i->second._time).count() >= ttl) i = _cache.erase(i);
+      else i++;
+    }
+    if (_cache.size() >= SUBST_CACHE_SIZE) _cache.clear();
+  }
+  _cache[key] = CacheEntry{command, cwd, output, now, 0};
+  return output;
+}
+
+// Print every cached substitution with its age, hit count, directory and
+// command text.
+void Subshell::printCache() {
+  auto now = std::chrono::steady_clock::now();
+  printf("age(s)\thits\tcwd\tcommand\n");
+  for (auto & entry : _cache) {
+    double age = std::chrono::duration<double>(now - entry.second._time).count();
+    printf("%.1f\t%d\t%s\t%s\n", age, entry.second._hits,
+           entry.second._cwd.c_str(), entry.second._command.c_str());
+  }
+}
+
+// Forget every cached substitution.
+void Subshell::clearCache() {
+  _cache.clear();
+}
+
+// Run command in a child shell and return its output with newlines turned
+// into spaces. By default the child is a fork of this (already initialized)
+// shell that parses the command text directly; with SUBSHELL_MODE=exec it
+// is a fresh /proc/self/exe reading the text from stdin. The command text
+// is written and the output drained concurrently in large chunks, so
+// neither side can block on a full pipe, and the child is only waited for
+// after its output reaches EOF.
+std::string Subshell::run( const std::string & command ) {
+  std::string mode;
+  bool exec_mode = Environment::get("SUBSHELL_MODE", mode) && mode == "exec";
+  std::string output;
+
+  // Initialze output pipe and check for errors
+  int pipeout[2];
+  if (pipe2(pipeout, O_CLOEXEC) == -1) {
+    perror("pipe");
+    exit(2);
+  }
+
+  // Fork mode: the child directs stdout to the pipe, parses the command
+  // text with a fresh scanner buffer and exits with its return status.
+  if (!exec_mode) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+      dup2(pipeout[1], 1);
+      close(pipeout[0]);
+      close(pipeout[1]);
+      int status = subshell_parse(command.c_str());
+      fflush(stdout);
+      _exit(status);
+    } else if (pid < 0) {
+      perror("fork");
+      exit(2);
+    }
+    close(pipeout[1]);
+    return collect(pid, "", pipeout[0]);
+  }
+
+  // Exec mode: pass exit command to input string to ensure subshell
+  // process exits, and feed it through an input pipe.
+  int pipein[2];
+  if (pipe2(pipein, O_CLOEXEC) == -1) {
+    perror("pipe");
+    exit(2);
+  }
+
+  // Create and execute the subshell process with no arguments, with the
+  // pipes as its stdin and stdout, checking for errors.
+  char * args[] = {(char *) "/proc/self/exe", NULL};
+  pid_t pid = Spawn::launch(args[0], args, pipein[0], pipeout[1], 2);
+  close(pipein[0]);
+  close(pipeout[1]);
+  if (pid < 0) {
+    perror("execvp");
+    close(pipein[1]);
+    close(pipeout[0]);
+    return output;
+  }
+  return collect(pid, command + "\nexit\n", pipeout[0], pipein[1]);
+}
+
+// Write input to the child (if fdin is given) while reading all of its
+// output from fdout, then reap the child and clean up the output. SIGPIPE
+// is ignored meanwhile so a child that exits before reading all of its
+// input cannot kill the shell; the write then fails with EPIPE, which ends
+// the input.
+std::string Subshell::collect( pid_t pid, const std::string & input, int fdout, int fdin ) {
+  std::string output;
+
+  struct sigaction ignore;
+  struct sigaction old_action;
+  ignore.sa_handler = SIG_IGN;
+  sigemptyset(&ignore.sa_mask);
+  ignore.sa_flags = 0;
+  if (fdin != -1) sigaction(SIGPIPE, &ignore, &old_action);
+
+  // Write the input and read the output as each pipe becomes ready.
+  if (fdin != -1) fcntl(fdin, F_SETFL, O_NONBLOCK);
+  size_t written = 0;
+  char buffer[SUBSHELL_CHUNK];
+  struct pollfd fds[2];
+  fds[0] = {fdout, POLLIN, 0};
+  fds[1] = {fdin, POLLOUT, 0};
+
+  while (fds[0].fd != -1) {
+    int nfds = fds[1].fd != -1 ? 2 : 1;
+    if (poll(fds, nfds, -1) == -1) {
+      if (errno == EINTR) continue;
+      perror("poll");
+      break;
+    }
+
+    // Feed more of the command text; close the pipe once it is all sent
+    // (or the child stopped reading: EPIPE).
+    if (nfds == 2 && fds[1].revents) {
+      ssize_t n = write(fdin, input.data() + written, input.size() - written);
+      if (n > 0) written += n;
+      if ((n < 0 && errno != EAGAIN && errno != EINTR) || written == input.size()) {
+        close(fdin);
+        fds[1].fd = -1;
+      }
+    }
+
+    // Append whatever output is available; stop at EOF.
+    if (fds[0].revents) {
+      ssize_t n = read(fdout, buffer, sizeof(buffer));
+      if (n > 0) {
+        output.append(buffer, n);
+      } else if (n == 0 || errno != EINTR) {
+        close(fdout);
+        fds[0].fd = -1;
+      }
+    }
+  }
+  if (fds[0].fd != -1) close(fdout);
+  if (fds[1].fd != -1) close(fdin);
+  if (fdin != -1) sigaction(SIGPIPE, &old_action, NULL);
+
+  // Wait for subshell to finish executing
+  while (waitpid(pid, NULL, 0) == -1 && errno == EINTR);
+
+  // Drop the goodbye message printed by the exit command, replace newline
+  // characters with spaces and trim trailing whitespace.
+  const std::string goodbye = "Good Bye!!\n";
+  if (output.size() >= goodbye.size() &&
+      output.compare(output.size() - goodbye.size(), goodbye.size(), goodbye) == 0) {
+    output.erase(output.size() - goodbye.size());
+  }
+  for (auto & c : output) {
+    if (c == '\n') c = ' ';
+  }
+  while (!output.empty() && (output.back() == ' ' || output.back() == '\t')) {
+    output.pop_back();
+  }
+  return output;
+}
+
+std::unordered_map<std::string, Subshell::CacheEntry> Subshell::_cache;
@@ -0,0 +1,35 @@
+#ifndef subshell_hh
+#define subshell_hh
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <sys/types.h>
+
+// Subshell Data Structure: runs the text of a command substitution in a
+// child shell and collects everything it prints. Outputs can optionally be
+// cached (SUBST_CACHE_TTL seconds) for commands that are repeated with the
+// same working directory and environment.
+
+struct Subshell {
+
+  struct CacheEntry {
+    std::string _command;
+    std::string _cwd;
+    std::string _output;
+    std::chrono::steady_clock::time_point _time;
+    int _hits;
+  };
+
+  static std::string substitute( const std::string & command );
+  static std::string run( const std::string & command );
+  static std::string collect( pid_t pid, const std::string & input, int fdout, int fdin = -1 );
+
+  static void printCache();
+  static void clearCache();
+
+  static std::unordered_map<std::string, CacheEntry> _cache;
+
+};
+
+#endif
@@ -0,0 +1,63 @@
+#!/bin/sh
+#
+# Benchmarks for the shell. Each one times the same work done two ways
+# and prints the time per operation of both and the speedup. They are not
+# part of make test, as the times depend on the machine.
+#
+# Usage: test-shell/benchmarks.sh [shell]
+
+SHELL_UNDER_TEST=$(cd "$(dirname "${1:-./shell}")" && pwd)/$(basename "${1:-./shell}")
+SCRATCH=$(mktemp -d)
+trap 'rm -rf "$SCRATCH"' EXIT
+cd "$SCRATCH" || exit 1
+
+# elapsed COMMAND...: run COMMAND (output discarded) and print how many
+# microseconds it took.
+elapsed() {
+  start=$(date +%s%N)
+  "$@" > /dev/null 2>&1
+  echo $((($(date +%s%N) - start) / 1000))
+}
+
+# report NAME COUNT SLOW FAST: print the time per operation of COUNT
+# operations done the slow way in SLOW and the fast way in FAST
+# microseconds, and the speedup.
+report() {
+  printf '%s: %d.%02d us -> %d.%02d us per operation, %d.%02dx\n' "$1" \
+    $(($3 / $2)) $(($3 * 100 / $2 % 100)) $(($4 / $2)) $(($4 * 100 / $2 % 100)) \
+    $(($3 / $4)) $(($3 * 100 / $4 % 100))
+}
+
+# Scripts: the same script compiled to bytecode and run by the VM (as a
+# script file) or parsed and run line by line (read from stdin), once as
+# straight-line commands and once as a loop.
+i=0
+while [ $i -lt 20000 ]; do
+  printf 'setenv X %d\ntrue\n' $i
+  i=$((i + 1))
+done > lines.sh
+echo 'for i in {1..100000}; do setenv X ${i}; true; done' > loop.sh
+report "script lines, VM vs line by line" 40000 \
+  "$(elapsed sh -c "'$SHELL_UNDER_TEST' < lines.sh")" "$(elapsed "$SHELL_UNDER_TEST" lines.sh)"
+report "script loop, VM vs line by line" 200000 \
+  "$(elapsed sh -c "'$SHELL_UNDER_TEST' < loop.sh")" "$(elapsed "$SHELL_UNDER_TEST" loop.sh)"
+
+# Functions: 100000 calls of a function against sourcing a file with the
+# same body, with the source cache on and off (the file is dated back, as
+# the cache skips files changed in the last second).
+echo 'setenv ARG ${1}; true' > body.sh
+touch -d '1 minute ago' body.sh
+printf 'f() { setenv ARG ${1}; true; }\nfor i in {1..100000}; do f ${i}; done\n' > call.sh
+echo 'for i in {1..100000}; do source body.sh; done' > source.sh
+calls=$(elapsed "$SHELL_UNDER_TEST" call.sh)
+report "function calls vs source (cached)" 100000 "$(elapsed "$SHELL_UNDER_TEST" source.sh)" "$calls"
+report "function calls vs source (uncached)" 100000 \
+  "$(elapsed env SOURCE_CACHE=0 "$SHELL_UNDER_TEST" source.sh)" "$calls"
+
+# Arithmetic: $(( )) evaluated in the shell against expr run through a
+# command substitution (a fork and an exec each time, so it only runs a
+# fiftieth as many times and its time is scaled up).
+echo 'for i in {1..100000}; do setenv X $((i * 2 + 1)); done' > arithmetic.sh
+echo 'for i in {1..2000}; do setenv X $(expr ${i} + 1); done' > expr.sh
+report "\$(( )) vs expr" 100000 \
+  "$(($(elapsed "$SHELL_UNDER_TEST" expr.sh) * 50))" "$(elapsed "$SHELL_UNDER_TEST" arithmetic.sh)"
@@ -0,0 +1,649 @@
+#!/bin/sh
+#
+# Regression tests for the shell. Each test runs a script with the shell
+# under test (./shell, or the binary given as the first argument) in a
+# scratch directory and compares what it prints with the expected output.
+#
+# Usage: test-shell/regressions.sh [shell]
+
+SHELL_UNDER_TEST=$(cd "$(dirname "${1:-./shell}")" && pwd)/$(basename "${1:-./shell}")
+SCRATCH=$(mktemp -d)
+trap 'rm -rf "$SCRATCH"' EXIT
+
+passed=0
+failed=0
+
+# check NAME EXPECTED [MODE]: run the script read from stdin and compare
+# its output (stdout and stderr) with EXPECTED. The shell runs it as a
+# script file, or with MODE "input" from its standard input and with MODE
+# "string" as the argument of -c. With MODE "terminal" the script is the
+# keys typed into an interactive shell on a terminal (run by script(1)),
+# and what the commands write to the file out is compared instead (what
+# the shell writes to the terminal is kept in $SCRATCH/terminal).
+check() {
+  cat > "$SCRATCH/test.sh"
+  case "${3:-file}" in
+    file) actual=$(cd "$SCRATCH/work" && timeout 10 "$SHELL_UNDER_TEST" ../test.sh 2>&1) ;;
+    input) actual=$(cd "$SCRATCH/work" && timeout 10 "$SHELL_UNDER_TEST" < ../test.sh 2>&1) ;;
+    string) actual=$(cd "$SCRATCH/work" && timeout 10 "$SHELL_UNDER_TEST" -c "$(cat ../test.sh)" 2>&1) ;;
+    terminal)
+      # script(1) blocks writing keys while the shell may be blocked
+      # writing to the terminal, so the keys are typed a little at a time.
+      (cd "$SCRATCH/work" && {
+         sleep 0.5
+         size=$(wc -c < ../test.sh)
+         i=0
+         while [ $((i * 256)) -lt "$size" ]; do
+           dd if=../test.sh bs=256 skip=$i count=1 2> /dev/null
+           sleep 0.05
+           i=$((i + 1))
+         done
+       } | timeout 30 script -qec "$SHELL_UNDER_TEST" /dev/null > ../terminal 2>&1)
+      actual=$(cat "$SCRATCH/work/out" 2>&1) ;;
+  esac
+  result "$1" "$2" "$actual"
+}
+
+# result NAME EXPECTED ACTUAL: count a test as passed if ACTUAL is EXPECTED.
+result() {
+  if [ "$3" = "$2" ]; then
+    passed=$((passed + 1))
+  else
+    failed=$((failed + 1))
+    printf 'FAIL: %s\n  expected: %s\n  actual:   %s\n' "$1" "$2" "$3"
+  fi
+}
+
+# Start every test from a fresh, empty working directory.
+reset() {
+  rm -rf "$SCRATCH/work"
+  mkdir "$SCRATCH/work"
+}
+
+# Wildcards: a word or path component with only a character class.
+reset
+touch "$SCRATCH/work/file1.c" "$SCRATCH/work/file2.c" "$SCRATCH/work/file3.c"
+check "class-only word" "file1.c file2.c" <<'SCRIPT'
+echo file[12].c
+SCRIPT
+
+reset
+mkdir "$SCRATCH/work/a" "$SCRATCH/work/b" "$SCRATCH/work/c"
+touch "$SCRATCH/work/a/x1" "$SCRATCH/work/b/x2" "$SCRATCH/work/c/x3"
+check "class-only component" "a/x1 b/x2" <<'SCRIPT'
+echo [ab]/x*
+SCRIPT
+
+reset
+check "lone [ is the test command" "yes" <<'SCRIPT'
+if [ 1 -lt 2 ]; then echo yes; fi
+SCRIPT
+
+# Arithmetic: +, -, * and negation wrap around; divisions that would trap
+# and out of range shift counts are errors.
+reset
+check "arithmetic wraps around" "-9223372036854775808
+9223372036854775807
+0
+-9223372036854775808" <<'SCRIPT'
+echo $((9223372036854775807 + 1))
+echo $((-9223372036854775807 - 2))
+echo $((4611686018427387904 * 4))
+echo $((-(-9223372036854775807 - 1)))
+SCRIPT
+
+reset
+check "arithmetic division errors" "arithmetic: division by zero
+syntax error
+arithmetic: division by zero
+syntax error
+arithmetic: division overflow
+syntax error
+arithmetic: division overflow
+syntax error
+done" <<'SCRIPT'
+echo $((7 / 0))
+echo $((7 % 0))
+echo $(((-9223372036854775807 - 1) / -1))
+echo $(((-9223372036854775807 - 1) % -1))
+echo done
+SCRIPT
+
+reset
+check "arithmetic shift counts" "arithmetic: shift count out of range
+syntax error
+arithmetic: shift count out of range
+syntax error
+-9223372036854775808
+-4" <<'SCRIPT'
+echo $((1 << 64))
+echo $((1 >> -1))
+echo $((1 << 63))
+echo $((-8 >> 1))
+SCRIPT
+
+# Semicolons end commands, except inside substitutions or when escaped.
+reset
+check "semicolon inside a substitution" "a b
+c" <<'SCRIPT'
+echo $(echo a; echo b); echo c
+SCRIPT
+
+reset
+check "semicolon inside backquotes" "d e
+f" <<'SCRIPT'
+echo `echo d; echo e`;echo f
+SCRIPT
+
+reset
+check "semicolon after a quoted word" "x
+y" <<'SCRIPT'
+echo "x";echo y
+SCRIPT
+
+reset
+check "escaped semicolon" "g;h" <<'SCRIPT'
+echo g\;h
+SCRIPT
+
+# Word expansion: escapes, quotes, ${} variables, $(( )) arithmetic and
+# tilde, also in a word much longer than the old line limit.
+reset
+{
+  printf 'echo '
+  i=0
+  while [ $i -lt 600 ]; do printf 'a\\ "b${V}"'; i=$((i + 1)); done
+  printf ' | wc -c\n'
+} > "$SCRATCH/work/long"
+check "word expansion" 'a b"c\d
+x val y
+prevalpost
+/h/dir /homes/user/dir
+/h/q
+6x 5 ab
+2401' <<'SCRIPT'
+setenv HOME /h
+setenv V val
+echo a\ b\"c\\d
+echo "x ${V} y"
+echo pre${V}post
+echo ~/dir ~user/dir
+echo "~/q"
+echo $((2 * 3))x $5 a$b
+setenv V v
+source long
+SCRIPT
+
+# Shell variables: the table keeps every variable through its growth and
+# after removals, children see exactly the exported ones, and a variable
+# set without setenv or export stays in the shell.
+reset
+check "variable table" "x1 x1500 x3000
+3000
+1500
+y1 x2 y2999 x3000
+3000
+0
+here
+loc=here
+0" <<'SCRIPT'
+for i in {1..3000}; do setenv V${i} x${i}; done
+echo ${V1} ${V1500} ${V3000}
+env | grep -c ^V
+for i in {1..3000..2}; do unset V${i}; done
+env | grep -c ^V
+for i in {1..3000..2}; do setenv V${i} y${i}; done
+echo ${V1} ${V2} ${V2999} ${V3000}
+env | grep -c ^V
+loc=here
+env | grep -c ^loc=
+echo ${loc}
+export loc
+env | grep ^loc=
+unset loc
+env | grep -c ^loc=
+SCRIPT
+
+# Source cache: a sourced file's tokens are replayed from memory and, in a
+# new shell, from the cache directory, until the file changes. The test
+# script itself is one more miss (it is too new to be cached).
+reset
+cat > "$SCRATCH/work/f" <<'EOF'
+greet() { echo hello ${1}; }
+for i in a b; do if true; then greet ${i}; fi; done
+EOF
+touch -d '1 hour ago' "$SCRATCH/work/f"
+check "source cache" "hello a
+hello b
+hello a
+hello b
+1 scripts cached, 1 hits, 2 misses (33.3% hit rate)
+changed
+1 scripts cached, 1 hits, 3 misses (25.0% hit rate)" <<'SCRIPT'
+setenv XDG_CACHE_HOME ../cache
+source f
+source f
+sourcecache
+echo echo changed > f
+source f
+sourcecache
+SCRIPT
+
+echo 'echo from disk' > "$SCRATCH/work/f"
+touch -d '1 hour ago' "$SCRATCH/work/f"
+check "source cache on disk" "from disk
+from disk
+1 scripts cached, 1 hits, 2 misses (33.3% hit rate)" <<'SCRIPT'
+setenv XDG_CACHE_HOME ../cache
+source f
+source f
+sourcecache
+SCRIPT
+
+check "source cache read from disk" "from disk
+1 scripts cached, 1 hits, 1 misses (50.0% hit rate)" <<'SCRIPT'
+setenv XDG_CACHE_HOME ../cache
+source f
+sourcecache
+SCRIPT
+
+# Cached command substitutions: a repeated substitution is served from the
+# cache, even as unexported variables (a loop variable) change, while a
+# change to the exported environment is a miss.
+reset
+check "cache hit in a loop" "cached
+cached
+cached
+run" <<'SCRIPT'
+SUBST_CACHE_TTL=100
+for i in 1 2 3; do
+echo $(echo run >> log; echo cached)
+done
+cat log
+SCRIPT
+
+reset
+check "cache miss on an exported change" "1
+2" <<'SCRIPT'
+SUBST_CACHE_TTL=100
+setenv X 1
+echo $(echo ${X})
+setenv X 2
+echo $(echo ${X})
+SCRIPT
+
+# Ctrl-C stops loops run inside the shell, and the script with them.
+reset
+check "interrupted for loop" "1" <<'SCRIPT'
+for i in 1 2 3; do
+echo ${i}
+kill -INT ${$}
+done
+echo after
+SCRIPT
+
+reset
+check "interrupted loop in a function" "1" <<'SCRIPT'
+f() {
+while true; do
+for i in 1 2 3; do
+echo ${i}
+kill -INT ${$}
+done
+done
+}
+f
+echo after
+SCRIPT
+
+# Spawned commands: only stdin, stdout and stderr are inherited, and
+# redirections and pipes are wired up in the child.
+reset
+check "spawned descriptors" "0
+1
+2
+3" <<'SCRIPT'
+ls /proc/self/fd
+SCRIPT
+
+reset
+check "spawned redirections and pipes" "a
+b" <<'SCRIPT'
+echo b > in
+echo a >> in
+sort | cat > out < in
+cat out
+SCRIPT
+
+# Pipelines: every stage is waited for, and each stage's status is kept.
+reset
+printf 'sleep 0.3\necho late > f\n' > "$SCRATCH/work/late.sh"
+check "every stage is waited for" "late" <<'SCRIPT'
+sh late.sh | true
+cat f
+SCRIPT
+
+reset
+printf 'kill -9 $$\n' > "$SCRATCH/work/killed.sh"
+check "status of each stage" "0 1 0
+0 137 1 0" <<'SCRIPT'
+false | true
+echo ${?} ${PIPESTATUS}
+true | sh killed.sh | false | true
+echo ${PIPESTATUS}
+SCRIPT
+
+# An executable file without a #! line is run by /bin/sh, as execvp does.
+reset
+printf 'echo plain script ${1}\n' > "$SCRATCH/work/plain"
+chmod +x "$SCRATCH/work/plain"
+check "script without #! line" "plain script arg" <<'SCRIPT'
+./plain arg
+SCRIPT
+
+# Hashed PATH lookups are forgotten when PATH changes.
+reset
+mkdir "$SCRATCH/work/bin1" "$SCRATCH/work/bin2"
+printf '#!/bin/sh\necho one\n' > "$SCRATCH/work/bin1/tool"
+printf '#!/bin/sh\necho two\n' > "$SCRATCH/work/bin2/tool"
+chmod +x "$SCRATCH/work/bin1/tool" "$SCRATCH/work/bin2/tool"
+check "PATH change clears the command hash" "one
+two" <<'SCRIPT'
+PATH=bin1
+tool
+PATH=bin2
+tool
+SCRIPT
+
+# Built-ins and functions in a pipeline run in a forked copy of the shell:
+# they see the pipes but cannot block or change the shell itself.
+reset
+echo "echo sourced" > "$SCRATCH/work/lib"
+check "source reading a pipe" "sourced
+hi" <<'SCRIPT'
+cat lib | source /dev/stdin
+echo hi | cat
+SCRIPT
+
+reset
+mkdir "$SCRATCH/work/sub"
+touch "$SCRATCH/work/top"
+check "pipeline stages keep the shell's state" "sub
+top
+x0x" <<'SCRIPT'
+x=0
+cd sub | cat
+x=1 | cat
+ls
+echo x${x}x
+SCRIPT
+
+# Built-in echo, printf, true, false and test.
+reset
+check "echo and printf built-ins" "ab
+x-5
+a
+xy" <<'SCRIPT'
+echo -n a
+echo b
+printf %s-%d x 5
+echo
+printf %c abc
+echo
+printf x%cy ""
+echo
+SCRIPT
+
+reset
+mkdir "$SCRATCH/work/sub"
+check "true, false and test built-ins" "0 1 0 1 0 1" <<'SCRIPT'
+true
+t=${?}
+false
+f=${?}
+test 1 -lt 2
+lt=${?}
+[ a = b ]
+eq=${?}
+test -d sub
+d=${?}
+[ -f nope ]
+echo ${t} ${f} ${lt} ${eq} ${d} ${?}
+SCRIPT
+
+# Command substitution output larger than a pipe buffer is read while the
+# child runs, in both subshell modes.
+reset
+check "large substitution output" "20000
+20000" <<'SCRIPT'
+echo $(seq 1 20000) | wc -w
+SUBSHELL_MODE=exec
+echo $(seq 1 20000) | wc -w
+SCRIPT
+
+# A forked subshell sees the shell's functions and unexported variables.
+reset
+check "forked substitution sees shell state" "from function local" <<'SCRIPT'
+f() {
+echo from function
+}
+y=local
+echo $(f) $(echo ${y})
+SCRIPT
+
+# Recursive ** wildcards: any depth, skipping hidden directories and not
+# following symbolic links.
+reset
+mkdir -p "$SCRATCH/work/a/b/c" "$SCRATCH/work/.hidden" "$SCRATCH/work/d"
+touch "$SCRATCH/work/a/b/c/x.c" "$SCRATCH/work/a/y.c" "$SCRATCH/work/z.c" \
+      "$SCRATCH/work/.hidden/w.c" "$SCRATCH/work/d/q.h"
+ln -s ../a "$SCRATCH/work/d/link"
+check "recursive wildcards" "a/b/c/x.c a/y.c z.c
+a/b a/b/c a/b/c/x.c a/y.c
+d/q.h" <<'SCRIPT'
+echo **/*.c
+echo a/**
+echo **/q.h
+SCRIPT
+
+# Directory listings are cached, but a change made right after a listing
+# is still seen.
+reset
+check "directory cache" "a.t
+a.t b.t
+b.t
+b.t
+b.t
+1 directories cached, 1 hits, 1 misses (50.0% hit rate)" <<'SCRIPT'
+touch a.t
+echo *.t
+touch b.t
+echo *.t
+rm a.t
+echo *.t
+sleep 1.2
+globcache -f
+echo *.t
+echo *.t
+globcache
+SCRIPT
+
+# Wildcard results: sorted, hidden names only for patterns starting with a
+# dot, a word without matches kept as written.
+reset
+mkdir "$SCRATCH/work/d1" "$SCRATCH/work/d2"
+touch "$SCRATCH/work/b" "$SCRATCH/work/a" "$SCRATCH/work/c" "$SCRATCH/work/.h" \
+      "$SCRATCH/work/d1/x" "$SCRATCH/work/d2/x"
+check "wildcard results" "a b c d1 d2
+. .. .h
+d1/x d2/x
+nomatch*
+a b c" <<'SCRIPT'
+echo *
+echo .*
+echo d*/x
+echo nomatch*
+echo ?
+SCRIPT
+
+# Brace expansion: only braces typed unquoted and unescaped expand, not
+# quoted or escaped ones, nor the ones in a variable or a substitution.
+reset
+check "quoted braces" 'a b
+{"a":1,"b":2}
+{a,b}
+{a,b}
+{1..3}
+x{a,b}y
+{a,b}
+{a,b}
+a, b
+1
+2
+3
+{4,5}' <<'SCRIPT'
+echo {a,b}
+echo "{\"a\":1,\"b\":2}"
+echo "{a,b}"
+echo \{a,b\}
+echo {1"..3}"
+echo x{a\,b}y
+setenv B "{a,b}"
+echo ${B}
+echo $(echo \{a,b\})
+echo {a",",b}
+for i in {1..3} "{4,5}"; do echo ${i}; done
+SCRIPT
+
+# Argument batching: with ARG_BATCH set, a command whose wildcards expand
+# past ARG_MAX runs as several execs, each with every literal argument (in
+# its place) and its share of the matches, in order.
+reset
+pad=$(printf '%0200d' 0)
+seq -w 1 6000 | sed "s/^/$pad/;s/\$/.a/" > "$SCRATCH/expected"
+seq -w 1 6000 | sed "s/^/$pad/;s/\$/.b/" >> "$SCRATCH/expected"
+(cd "$SCRATCH/work" && xargs touch < ../expected)
+cat > "$SCRATCH/work/show" <<'EOF'
+#!/bin/sh
+[ "$1" = first ] || echo "no first" >> batches
+shift
+last=no
+for a; do
+  if [ "$a" = dest ]; then last=dest; else echo "$a" >> log; fi
+done
+echo $last >> batches
+EOF
+chmod +x "$SCRATCH/work/show"
+check "argument batching" "dest
+0
+12000
+more than one batch" <<'SCRIPT'
+setenv ARG_BATCH 1
+./show first *.a dest *.b
+sort -u batches
+cmp log ../expected
+echo ${?}
+wc -l < log
+sed -n 2s/.*/more\ than\ one\ batch/p batches
+SCRIPT
+
+# Reserved words: the end of a sourced file (scanned or replayed from the
+# cache) leaves the input at the start of a command, and so does the start
+# of a command substitution, whatever its parent was scanning.
+reset
+echo "echo in f" > "$SCRATCH/work/f"
+check "reserved words after source" "in f
+yes
+in f
+yes
+in f
+again" input <<'SCRIPT'
+source f
+if true; then echo yes; fi
+source f; if true; then echo yes; fi
+source f
+if true; then echo again; fi
+SCRIPT
+
+reset
+check "reserved words in a substitution" "a b" string <<'SCRIPT'
+echo $(for i in a b; do echo ${i}; done)
+SCRIPT
+
+# Syntax tree: a line is parsed whole before any of it runs, so a syntax
+# error anywhere in it runs none of it; control flow constructs nest.
+reset
+check "parse before running" "syntax error
+after
+three
+two
+2
+other" input <<'SCRIPT'
+echo before; echo broken |
+echo after
+x=3
+while test ${x} -gt 0; do
+  if test ${x} -eq 3; then echo three
+  elif test ${x} -eq 2; then { echo two; echo 2; }
+  else echo other; fi
+  x=$((x - 1))
+done
+SCRIPT
+
+# Functions: positional parameters of their own (restored after the call),
+# recursion, return and "${@}".
+reset
+check "function arguments" "2: 2 x
+2: 1 x
+2: 0 x
+status 3
+[a b]
+[c]
+outside 0" <<'SCRIPT'
+count() {
+  echo ${#}: ${1} ${2}
+  if test ${1} -gt 0; then count $((${1} - 1)) ${2}; fi
+  return 3
+}
+count 2 x
+echo status ${?}
+args() { for a in "${@}"; do echo [${a}]; done; }
+args "a b" c
+echo outside ${#}
+SCRIPT
+
+# Line editor: editing in the middle of a line, lines past the old 2048
+# character limit, history past 2048 entries, bracketed paste and unknown
+# escape sequences. Each test types its keys into a terminal.
+if command -v script > /dev/null; then
+  reset
+  printf 'echo %s | wc -c > out\r' "$(printf '%04000d' 0)" > "$SCRATCH/keys"
+  printf 'cho edited >> out\033[He\r' >> "$SCRATCH/keys"
+  printf 'exit\r' >> "$SCRATCH/keys"
+  check "line editing" "4001
+edited" terminal < "$SCRATCH/keys"
+  # Moving over "cho edited >> out" is one cursor movement, not a
+  # backspace per character.
+  result "cursor movement" "0 backspaces, 2 moves" \
+    "$(tr -cd '\010' < "$SCRATCH/terminal" | wc -c) backspaces, $(grep -o "$(printf '\033')\[17D" "$SCRATCH/terminal" | wc -l) moves"
+
+  reset
+  {
+    printf 'echo first >> out\r'
+    i=0
+    while [ $i -lt 2100 ]; do printf 'true\r'; i=$((i + 1)); done
+    printf '\033[B\rexit\r'
+  } > "$SCRATCH/keys"
+  check "long history" "first
+first" terminal < "$SCRATCH/keys"
+
+  reset
+  printf '\033[200~echo pasted\tline >> out\033[201~\r' > "$SCRATCH/keys"
+  printf 'echo typed\033[1;5C\033[99~\033OQ >> out\r' >> "$SCRATCH/keys"
+  printf 'exit\r' >> "$SCRATCH/keys"
+  check "paste and escape sequences" "pasted line
+typed" terminal < "$SCRATCH/keys"
+fi
+
+echo "$passed passed, $failed failed"
+[ "$failed" -eq 0 ]
@@ -0,0 +1,155 @@
+#include <cstdio>
+
+#include "vm.hh"
+#include "environment.hh"
+#include "executor.hh"
+#include "functions.hh"
+#include "pipeline.hh"
+#include "shell.hh"
+
+// Run every instruction of program. If a word or redirection target of a
+// pipeline cannot be expanded, the rest of that pipeline is skipped. A
+// Ctrl-C stops the program after the current command or loop iteration,
+// with status 130. Returns the status of the last command.
+int VM::run( const Program & program ) {
+  Command command;
+  SimpleCommand * simpleCommand = NULL;
+  bool wordList = false;
+  LoopValues wordValues;
+  Pipeline pipeline(0);
+  std::vector<Loop> loops;
+
+  // Add the simple command being built to the command, unless it has no
+  // arguments (only substitutions with no output), which runs nothing.
+  auto finishSimpleCommand = [&]() {
+    if (!simpleCommand) return;
+    if (simpleCommand->_arguments.empty()) delete simpleCommand;
+    else command.insertSimpleCommand(simpleCommand);
+    simpleCommand = NULL;
+  };
+
+  if (Executor::_running == 0) Shell::_interrupted = 0;
+  Executor::_running++;
+  const std::vector<Instruction> & code = program._code;
+  for (size_t pc = 0; pc < code.size(); pc++) {
+    const Instruction & instruction = code[pc];
+    bool failed = false;
+
+    switch (instruction._opcode) {
+    case Instruction::PIPELINE:
+      command._background = instruction._operand;
+      break;
+    case Instruction::COMMAND:
+      finishSimpleCommand();
+      simpleCommand = new SimpleCommand();
+      wordList = instruction._operand;
+      if (wordList) wordValues = LoopValues();
+      break;
+    case Instruction::LITERAL:
+      if (wordList) wordValues.add(program._strings[instruction._operand]);
+      else simpleCommand->insertArgument(new std::string(program._strings[instruction._operand]));
+      break;
+    case Instruction::EXPAND:
+      if (wordList) failed = !Executor::expandLoopWord(program._words[instruction._operand], wordValues);
+      else failed = !Executor::expandWord(program._words[instruction._operand], simpleCommand);
+      break;
+    case Instruction::REDIRECT:
+      finishSimpleCommand();
+      failed = !Executor::redirect(program._redirects[instruction._operand], command);
+      break;
+    case Instruction::BUILTIN:
+      // A function defined since with the name of the built-in is called
+      // instead.
+      finishSimpleCommand();
+      pipeline = Pipeline(1);
+      if (Functions::find(program._builtins[instruction._operand]->_name)) command.launch(pipeline);
+      else command.call(program._builtins[instruction._operand], pipeline);
+      break;
+    case Instruction::ASSIGN:
+      finishSimpleCommand();
+      pipeline = Pipeline(1);
+      command.assign(pipeline);
+      break;
+    case Instruction::SPAWN:
+      finishSimpleCommand();
+      pipeline = Pipeline(command._simpleCommands.size());
+      if (!command._simpleCommands.empty()) command.launch(pipeline);
+      break;
+    case Instruction::WAIT:
+      if (command._simpleCommands.empty()) command.clear();
+      else command.wait(pipeline);
+      break;
+    case Instruction::JUMP:
+      pc = instruction._operand - 1;
+      break;
+    case Instruction::BRANCH:
+      if (Shell::_returnStatus != 0) pc = instruction._operand - 1;
+      break;
+    case Instruction::STATUS:
+      Shell::_returnStatus = instruction._operand;
+      break;
+    case Instruction::FOR: {
+      // A word list that failed to expand loops over nothing, keeping the
+      // failed status.
+      Loop loop = { &program._strings[instruction._operand], LoopValues(), 0 };
+      if (simpleCommand) {
+        loop._values = std::move(wordValues);
+        delete simpleCommand;
+        simpleCommand = NULL;
+      } else {
+        loop._status = Shell::_returnStatus;
+      }
+      loops.push_back(std::move(loop));
+      break;
+    }
+    case Instruction::NEXT: {
+      Loop & loop = loops.back();
+      std::string value;
+      if (loop._values.next(value)) {
+        Environment::set(*loop._name, value);
+      } else {
+        Shell::_returnStatus = loop._status;
+        loops.pop_back();
+        pc = instruction._operand - 1;
+      }
+      break;
+    }
+    case Instruction::WHILE:
+      loops.push_back({ NULL, LoopValues(), 0 });
+      break;
+    case Instruction::TEST:
+      if (Shell::_returnStatus != 0) {
+        Shell::_returnStatus = loops.back()._status;
+        loops.pop_back();
+        pc = instruction._operand - 1;
+      }
+      break;
+    case Instruction::LOOP:
+      loops.back()._status = Shell::_returnStatus;
+      pc = instruction._operand - 1;
+      break;
+    case Instruction::FUNCTION:
+      Functions::define(program._functions[instruction._operand].first,
+                        program._functions[instruction._operand].second);
+      Shell::_returnStatus = 0;
+      break;
+    }
+
+    // Skip the rest of the pipeline, or of a for loop's word list.
+    if (failed) {
+      fprintf(stderr, "syntax error\n");
+      delete simpleCommand;
+      simpleCommand = NULL;
+      command.clear();
+      Shell::_returnStatus = 1;
+      while (code[pc + 1]._opcode != Instruction::WAIT && code[pc + 1]._opcode != Instruction::FOR) pc++;
+    }
+
+    if ((instruction._opcode == Instruction::WAIT || instruction._opcode == Instruction::NEXT ||
+         instruction._opcode == Instruction::LOOP) && Executor::interrupted()) {
+      break;
+    }
+  }
+  Executor::_running--;
+  return Shell::_returnStatus;
+}
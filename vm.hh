@@ -0,0 +1,24 @@
+#ifndef vm_hh
+#define vm_hh
+
+#include "bytecode.hh"
+#include "executor.hh"
+
+// Virtual Machine: runs a compiled program, building each pipeline into a
+// Command and launching it with the same runtime the executor uses.
+
+struct VM {
+
+  // A for or while loop in progress: a for loop's variable, the values
+  // left to give it, and the status of the last body run.
+  struct Loop {
+    const std::string * _name;
+    LoopValues _values;
+    int _status;
+  };
+
+  static int run( const Program & program );
+
+};
+
+#endif
@@ -0,0 +1,281 @@
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <unistd.h>
+
+#include "wildcard.hh"
+#include "braceExpansion.hh"
+#include "dirCache.hh"
+#include "dirWalker.hh"
+
+// Compile a pattern: split it into tokens, then move the literal run at
+// the start into _prefix and the literal run at the end into _suffix so
+// most names can be rejected by comparing a few bytes.
+WildcardPattern::WildcardPattern( const std::string & pattern ) {
+  std::vector<Token> tokens;
+  for (size_t i = 0; i < pattern.size(); i++) {
+    Token token;
+    token._literal = pattern[i];
+    if (pattern[i] == '*') {
+      // Consecutive stars are equivalent to a single one.
+      if (!tokens.empty() && tokens.back()._type == ANY_MANY) continue;
+      token._type = ANY_MANY;
+    } else if (pattern[i] == '?') {
+      token._type = ANY_ONE;
+    } else if (pattern[i] == '[' && pattern.find(']', i + 2) != std::string::npos) {
+      // Character class: [abc], [a-z], negated with [!...] or [^...]. A ]
+      // right after the opening bracket is part of the class.
+      size_t j = i + 1;
+      bool negate = pattern[j] == '!' || pattern[j] == '^';
+      if (negate) j++;
+      token._type = CLASS;
+      size_t first = j;
+      while (j < pattern.size() && (pattern[j] != ']' || j == first)) {
+        unsigned char low = pattern[j];
+        unsigned char high = low;
+        if (j + 2 < pattern.size() && pattern[j + 1] == '-' && pattern[j + 2] != ']') {
+          high = pattern[j + 2];
+          j += 2;
+        }
+        for (unsigned int c = low; c <= high; c++) token._class.set(c);
+        j++;
+      }
+      if (j == pattern.size()) {
+        // No closing bracket after all: treat [ as a literal.
+        token._type = LITERAL;
+        token._class.reset();
+      } else {
+        if (negate) token._class.flip();
+        i = j;
+      }
+    } else {
+      token._type = LITERAL;
+    }
+    tokens.push_back(token);
+  }
+
+  size_t start = 0;
+  while (start < tokens.size() && tokens[start]._type == LITERAL) {
+    _prefix += tokens[start++]._literal;
+  }
+  size_t end = tokens.size();
+  while (end > start && tokens[end - 1]._type == LITERAL) {
+    end--;
+  }
+  for (size_t i = end; i < tokens.size(); i++) _suffix += tokens[i]._literal;
+  _tokens.assign(tokens.begin() + start, tokens.begin() + end);
+
+  _minLength = _prefix.size() + _suffix.size();
+  for (auto & token : _tokens) {
+    if (token._type != ANY_MANY) _minLength++;
+  }
+}
+
+// Return true if name matches the whole pattern.
+bool WildcardPattern::matches( const char * name ) const {
+  // Fast paths: length, literal prefix and literal suffix.
+  size_t length = strlen(name);
+  if (length < _minLength) return false;
+  if (memcmp(name, _prefix.data(), _prefix.size()) != 0) return false;
+  if (memcmp(name + length - _suffix.size(), _suffix.data(), _suffix.size()) != 0) return false;
+
+  // Match the middle tokens against the rest of the name. On a mismatch,
+  // let the most recent star absorb one more character and retry from
+  // there; this never needs more than one backtrack point.
+  const char * s = name + _prefix.size();
+  const char * s_end = name + length - _suffix.size();
+  size_t t = 0;
+  size_t star = std::string::npos;
+  const char * star_s = NULL;
+
+  while (s < s_end) {
+    if (t < _tokens.size()) {
+      const Token & token = _tokens[t];
+      if (token._type == ANY_MANY) {
+        star = t++;
+        star_s = s;
+        continue;
+      }
+      bool ok = token._type == ANY_ONE ||
+                (token._type == LITERAL && token._literal == *s) ||
+                (token._type == CLASS && token._class.test((unsigned char) *s));
+      if (ok) {
+        t++;
+        s++;
+        continue;
+      }
+    }
+    if (star == std::string::npos) return false;
+    t = star + 1;
+    s = ++star_s;
+  }
+
+  // Only stars may be left unmatched.
+  while (t < _tokens.size() && _tokens[t]._type == ANY_MANY) t++;
+  return t == _tokens.size();
+}
+
+// Called on every argument to expand braces and wildcards if present,
+// adding the resulting arguments to simpleCommand. literal flags the
+// characters of argument that are not brace syntax (see BraceExpansion).
+void expandWildcardsIfNecessary(std::string * argument, const std::string & literal,
+                                SimpleCommand * simpleCommand) {
+  if (!strchr(argument->c_str(), '{')) {
+    expandWildcards(argument, simpleCommand);
+    return;
+  }
+
+  // Generate the words of a brace expansion one at a time and expand the
+  // wildcards in each of them. Braces that do not form a list or range
+  // are kept as they are.
+  BraceExpansion braces(*argument, literal);
+  if (!braces.hasBraces()) {
+    expandWildcards(argument, simpleCommand);
+    return;
+  }
+  size_t count = braces.count();
+  if (count > BraceExpansion::limit()) {
+    fprintf(stderr, "%s: brace expansion exceeds BRACE_MAX\n", argument->c_str());
+    simpleCommand->insertArgument(argument);
+    return;
+  }
+  size_t first = simpleCommand->_arguments.size();
+  std::string word;
+  while (braces.next(word)) {
+    expandWildcards(new std::string(word), simpleCommand);
+  }
+  simpleCommand->markExpanded(first);
+  delete argument;
+}
+
+// Whether text has a wildcard: a * or ?, or a [ with a ] after the
+// character right after it (a character class). A lone [ (the test
+// command) is not one.
+static bool hasWildcard(std::string_view text) {
+  if (text.find_first_of("*?") != std::string_view::npos) return true;
+  size_t open = text.find('[');
+  return open != std::string_view::npos && text.find(']', open + 2) != std::string_view::npos;
+}
+
+// Call recursive wildcard function if *, ? or a character class are present.
+void expandWildcards(std::string * argument, SimpleCommand * simpleCommand) {
+  // No wildcard present, so argument can be handled normally. Insert argument and return.
+  if (!hasWildcard(*argument)) {
+    simpleCommand->insertArgument(argument);
+    return;
+  }
+
+  // Set up the state of this expansion. Absolute arguments start from the
+  // root directory, relative ones from the current directory.
+  WildcardExpansion expansion;
+  expansion._globstarDepth = 0;
+  std::string_view rest = *argument;
+  if (rest[0] == '/') {
+    expansion._path = "/";
+    rest.remove_prefix(1);
+  }
+  expandWildcard(expansion, rest);
+
+  // If nothing matched, the argument is inserted unmodified.
+  if (expansion._results.empty()) {
+    simpleCommand->insertArgument(argument);
+    return;
+  }
+
+  // Sort the expanded arguments in ascending order and move each one
+  // straight into the current simple command.
+  std::sort(expansion._results.begin(), expansion._results.end());
+  size_t first = simpleCommand->_arguments.size();
+  for (auto & result : expansion._results) {
+    simpleCommand->insertArgument(new std::string(std::move(result)));
+  }
+  simpleCommand->markExpanded(first);
+  delete argument;
+}
+
+// Append one path component to the path being built.
+static void appendComponent(std::string & path, std::string_view component) {
+  if (!path.empty() && path.back() != '/') path += '/';
+  path.append(component.data(), component.size());
+}
+
+// Recursive wildcard expansion function: expands the remaining components
+// of the argument (rest) below the path built so far, adding complete
+// matches to the expansion results. The path is extended in place for each
+// recursive call and truncated back afterwards, so no strings are
+// allocated per level.
+void expandWildcard(WildcardExpansion & expansion, std::string_view rest) {
+  std::string & path = expansion._path;
+
+  // If no suffix exists, we have expanded as far as required and
+  // insert the created argument into the results. Below a ** the literal
+  // parts of the argument were not checked while walking, so only keep
+  // paths that actually exist.
+  if (rest.empty()) {
+    if (expansion._globstarDepth > 0 && access(path.c_str(), F_OK) != 0) return;
+    expansion._results.push_back(path);
+    return;
+  }
+
+  // Split off the component of the current level from the rest.
+  size_t slash = rest.find('/');
+  std::string_view component = rest.substr(0, slash);
+  std::string_view next = slash == std::string_view::npos ? std::string_view() : rest.substr(slash + 1);
+  size_t saved = path.size();
+
+  // If no wildcard is in the current level, no expansion is necessary.
+  // Continue with the next level.
+  if (!hasWildcard(component)) {
+    appendComponent(path, component);
+    expandWildcard(expansion, next);
+    path.resize(saved);
+    return;
+  }
+
+  // Directory to search for matches in.
+  std::string dir_path = path.empty() ? "." : path;
+
+  // RECURSIVE WILDCARD: ** matches the current directory and every directory
+  // below it. Walk them all in parallel, then expand the rest of the argument
+  // in each one (a trailing ** lists everything inside them).
+  if (component == "**") {
+    std::string_view after = next.empty() ? std::string_view("*") : next;
+    expansion._globstarDepth++;
+    for (auto & dir : DirWalker::walk(dir_path)) {
+      if (!dir.empty()) appendComponent(path, dir);
+      expandWildcard(expansion, after);
+      path.resize(saved);
+    }
+    expansion._globstarDepth--;
+    return;
+  }
+
+  // Compile the wildcard pattern of the current level once and match it
+  // against every entry of the directory (from the directory cache when
+  // it has not changed since it was last read).
+  WildcardPattern pattern{std::string(component)};
+  DirListing dir = DirCache::list(dir_path);
+  if (dir == NULL) return;
+
+  // For every match, extend the path and continue expanding in the next
+  // level. Hidden entries only match patterns that start with a dot.
+  bool found = false;
+  for (auto & name : *dir) {
+    if (!pattern.matches(name.c_str())) continue;
+    if (name[0] == '.' && component[0] != '.') continue;
+    found = true;
+    appendComponent(path, name);
+    expandWildcard(expansion, next);
+    path.resize(saved);
+  }
+
+  // If no matches were found and no total entries have been added, then the
+  // current level was not actually a wildcard. Keep it unmodified and try
+  // the next level.
+  if (!found && expansion._results.empty() && expansion._globstarDepth == 0) {
+    appendComponent(path, component);
+    expandWildcard(expansion, next);
+    path.resize(saved);
+  }
+}
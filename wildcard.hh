@@ -0,0 +1,50 @@
+#ifndef wildcard_hh
+#define wildcard_hh
+
+#include <bitset>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "simpleCommand.hh"
+
+// Wildcard Pattern Data Structure: one path component of a glob (with *,
+// ? and [...] classes) compiled once and matched against many file names.
+
+struct WildcardPattern {
+
+  enum TokenType { LITERAL, ANY_ONE, ANY_MANY, CLASS };
+
+  struct Token {
+    TokenType _type;
+    char _literal;
+    std::bitset<256> _class;
+  };
+
+  // Literal characters the name must start and end with, and the tokens
+  // that have to match whatever lies between them.
+  std::string _prefix;
+  std::string _suffix;
+  std::vector<Token> _tokens;
+  size_t _minLength;
+
+  WildcardPattern( const std::string & pattern );
+  bool matches( const char * name ) const;
+
+};
+
+// State of one wildcard expansion: the path built so far (extended and
+// truncated in place while recursing), the complete matches, and how many
+// ** components enclose the current level.
+struct WildcardExpansion {
+  std::string _path;
+  std::vector<std::string> _results;
+  int _globstarDepth;
+};
+
+void expandWildcardsIfNecessary(std::string * argument, const std::string & literal,
+                                SimpleCommand * simpleCommand);
+void expandWildcards(std::string * argument, SimpleCommand * simpleCommand);
+void expandWildcard(WildcardExpansion & expansion, std::string_view rest);
+
+#endif
@@ -0,0 +1,122 @@
+#include <cstdlib>
+#include <cstring>
+
+#include <unistd.h>
+
+#include "wordExpansion.hh"
+#include "arithmetic.hh"
+#include "environment.hh"
+#include "shell.hh"
+
+// Append the value of the variable name to word. Covers the shell's own
+// variables (${$}, ${?}, ${!}, ${_}, ${PIPESTATUS}, ${SHELL}), the
+// positional parameters (${0}, ${1}, ..., ${#} and ${@} or ${*}) and the
+// environment. Returns false if the variable is not set; positional
+// parameters past the last one are empty.
+bool WordExpansion::variable( const std::string & name, std::string & word ) {
+  if (name == "$") {
+    word += std::to_string(getpid());
+  } else if (name == "?") {
+    word += std::to_string(Shell::_returnStatus);
+  } else if (name == "!" && Shell::_lastBkgProcess != -1) {
+    word += std::to_string(Shell::_lastBkgProcess);
+  } else if (name == "_" && Command::getLastArgument().size() > 0) {
+    word += Command::getLastArgument();
+  } else if (name == "PIPESTATUS") {
+    for (size_t i = 0; i < Shell::_pipeStatus.size(); i++) {
+      if (i > 0) word += ' ';
+      word += std::to_string(Shell::_pipeStatus[i]);
+    }
+  } else if (name == "#") {
+    word += std::to_string(Shell::_arguments.empty() ? 0 : Shell::_arguments.size() - 1);
+  } else if (name == "@" || name == "*") {
+    for (size_t i = 1; i < Shell::_arguments.size(); i++) {
+      if (i > 1) word += ' ';
+      word += Shell::_arguments[i];
+    }
+  } else if (!name.empty() && name.find_first_not_of("0123456789") == std::string::npos) {
+    size_t index = strtoul(name.c_str(), NULL, 10);
+    if (index < Shell::_arguments.size()) word += Shell::_arguments[index];
+  } else if (name == "SHELL") {
+    char path[1024];
+    if (realpath("../shell", path)) word += path;
+  } else {
+    std::string value;
+    if (!Environment::get(name, value)) return false;
+    word += value;
+  }
+  return true;
+}
+
+// Expand the text of a WORD token into word, reading each character once:
+//  - a leading ~ or ~user (optionally after the opening quote) becomes
+//    HOME or /homes/user,
+//  - ${name} is replaced by the value of the variable, $((expression)) by
+//    its value, and any other $ is dropped,
+//  - a backslash keeps the character after it as it is,
+//  - if quotes is set, double quotes are removed (and must be balanced).
+// If literal is given, it gets one flag per character of word: '0' for
+// the unquoted, unescaped characters of the text itself and '1' for the
+// rest (quoted, escaped or expanded), which brace expansion leaves alone.
+// Returns false on a syntax error: unbalanced quotes, an unterminated ${
+// or $((, an unset variable or a bad arithmetic expression.
+bool WordExpansion::expand( const char * text, size_t length, bool quotes, std::string & word,
+                            std::string * literal ) {
+  word.clear();
+  if (literal) literal->clear();
+  word.reserve(length);
+  size_t i = 0;
+  int quote_count = 0;
+
+  // TILDE EXPANSION: ~ at the start of the word, up to the first slash.
+  size_t tilde = (quotes && length > 0 && text[0] == '\"') ? 1 : 0;
+  if (tilde < length && text[tilde] == '~') {
+    quote_count += tilde;
+    size_t end = tilde + 1;
+    while (end < length && text[end] != '/' && text[end] != '\"') end++;
+    if (end == tilde + 1) {
+      std::string home;
+      if (Environment::get("HOME", home)) word += home;
+    } else {
+      word += "/homes/";
+      word.append(text + tilde + 1, end - tilde - 1);
+    }
+    if (literal) literal->assign(word.size(), '1');
+    i = end;
+  }
+
+  for (; i < length; i++) {
+    char c = text[i];
+    bool plain = false;
+    if (c == '\\') {
+      if (i + 1 < length) word += text[++i];
+    } else if (c == '\"' && quotes) {
+      quote_count++;
+    } else if (c == '$' && i + 1 < length) {
+      if (text[i + 1] == '(' && i + 2 < length && text[i + 2] == '(') {
+        // ARITHMETIC: $((expression)), up to the parenthesis closing it.
+        size_t end = i + 3;
+        for (int depth = 2; end < length; end++) {
+          if (text[end] == '(') depth++;
+          else if (text[end] == ')' && --depth == 0) break;
+        }
+        if (end >= length || text[end - 1] != ')') return false;
+        if (!Arithmetic::evaluate(std::string(text + i + 3, end - i - 4), word)) return false;
+        i = end;
+      } else if (text[i + 1] == '{') {
+        // ENVIRONMENTAL VARIABLES: expand ${name}; any other $ is dropped.
+        const char * end = (const char *) memchr(text + i + 2, '}', length - i - 2);
+        if (!end) return false;
+        if (!variable(std::string(text + i + 2, end), word)) return false;
+        i = end - text;
+      }
+    } else {
+      word += c;
+      plain = quote_count % 2 == 0;
+    }
+    if (literal) literal->resize(word.size(), plain ? '0' : '1');
+  }
+
+  // An odd number of quotes is a syntax error.
+  return quote_count % 2 == 0;
+}
@@ -0,0 +1,18 @@
+#ifndef wordExpansion_hh
+#define wordExpansion_hh
+
+#include <string>
+
+// Word Expansion Data Structure: turns the text of a WORD token into the
+// argument it stands for (tilde expansion, ${} variables, quote removal
+// and escapes) in a single pass over the text.
+
+struct WordExpansion {
+
+  static bool expand( const char * text, size_t length, bool quotes, std::string & word,
+                     std::string * literal = NULL );
+  static bool variable( const std::string & name, std::string & word );
+
+};
+
+#endif